@@ -59,6 +59,9 @@ typedef unsigned int u_int;
 #include <openssl/ebcdic.h>
 #endif
 #include "internal/sockets.h"
+#ifndef OPENSSL_NO_KTLS
+# include <sys/stat.h>
+#endif
 
 static int not_resumable_sess_cb(SSL *s, int is_forward_secure);
 static int sv_body(int s, int stype, int prot, unsigned char *context);
@@ -118,6 +121,9 @@ static int dtlslisten = 0;
 static int stateless = 0;
 
 static int early_data = 0;
+#ifndef OPENSSL_NO_KTLS
+static int use_sendfile = 0;
+#endif
 static SSL_SESSION *psksess = NULL;
 
 static char *psk_identity = "Client_identity";
@@ -752,6 +758,7 @@ typedef enum OPTION_choice {
     OPT_SRTP_PROFILES, OPT_KEYMATEXPORT, OPT_KEYMATEXPORTLEN,
     OPT_KEYLOG_FILE, OPT_MAX_EARLY, OPT_RECV_MAX_EARLY, OPT_EARLY_DATA,
     OPT_S_NUM_TICKETS, OPT_ANTI_REPLAY, OPT_NO_ANTI_REPLAY, OPT_SCTP_LABEL_BUG,
+    OPT_KTLS, OPT_SENDFILE,
     OPT_R_ENUM,
     OPT_S_ENUM,
     OPT_V_ENUM,
@@ -966,6 +973,11 @@ const OPTIONS s_server_options[] = {
      "The number of TLSv1.3 session tickets that a server will automatically  issue" },
     {"anti_replay", OPT_ANTI_REPLAY, '-', "Switch on anti-replay protection (default)"},
     {"no_anti_replay", OPT_NO_ANTI_REPLAY, '-', "Switch off anti-replay protection"},
+#ifndef OPENSSL_NO_KTLS
+    {"ktls", OPT_KTLS, '-', "Enable Kernel TLS for sending and receiving"},
+    {"sendfile", OPT_SENDFILE, '-',
+     "Use sendfile to send files for -WWW or -HTTP (implies -ktls)"},
+#endif
     {NULL, OPT_EOF, 0, NULL}
 };
 
@@ -997,6 +1009,9 @@ int s_server_main(int argc, char *argv[])
 #ifndef OPENSSL_NO_DH
     char *dhfile = NULL;
     int no_dhe = 0;
+#endif
+#ifndef OPENSSL_NO_KTLS
+    int enable_ktls = 0;
 #endif
     int nocert = 0, ret = 1;
     int noCApath = 0, noCAfile = 0;
@@ -1065,6 +1080,9 @@ int s_server_main(int argc, char *argv[])
     s_quiet = 0;
     s_brief = 0;
     async = 0;
+#ifndef OPENSSL_NO_KTLS
+    use_sendfile = 0;
+#endif
 
     cctx = SSL_CONF_CTX_new();
     vpm = X509_VERIFY_PARAM_new();
@@ -1497,6 +1515,16 @@ int s_server_main(int argc, char *argv[])
         case OPT_SCTP_LABEL_BUG:
 #ifndef OPENSSL_NO_SCTP
             sctp_label_bug = 1;
+#endif
+            break;
+        case OPT_KTLS:
+#ifndef OPENSSL_NO_KTLS
+            enable_ktls = 1;
+#endif
+            break;
+        case OPT_SENDFILE:
+#ifndef OPENSSL_NO_KTLS
+            use_sendfile = 1;
 #endif
             break;
         case OPT_TIMEOUT:
@@ -1630,6 +1658,18 @@ int s_server_main(int argc, char *argv[])
         goto end;
     }
 #endif
+#ifndef OPENSSL_NO_KTLS
+    if (use_sendfile && www <= 1) {
+        BIO_printf(bio_err, "Can't use -sendfile without -WWW or -HTTP\n");
+        goto end;
+    }
+    if (use_sendfile && !enable_ktls) {
+        BIO_printf(bio_err,
+                   "Warning: -sendfile depends on -ktls, enabling -ktls now.\n");
+        enable_ktls = 1;
+    }
+#endif
+
     if (early_data && (www > 0 || rev)) {
         BIO_printf(bio_err,
                    "Can't use -early_data in combination with -www, -WWW, -HTTP, or -rev\n");
@@ -1787,6 +1827,11 @@ int s_server_main(int argc, char *argv[])
 
     SSL_CTX_clear_mode(ctx, SSL_MODE_AUTO_RETRY);
 
+#ifndef OPENSSL_NO_KTLS
+    if (enable_ktls)
+        SSL_CTX_set_options(ctx, SSL_OP_ENABLE_KTLS);
+#endif
+
     if (sdebug)
         ssl_ctx_security_debug(ctx, sdebug);
 
@@ -2957,6 +3002,9 @@ static int www_body(int s, int stype, int prot, unsigned char *context)
     int total_bytes = 0;
 #endif
     int width;
+#ifndef OPENSSL_NO_KTLS
+    int use_sendfile_for_req = use_sendfile;
+#endif
     fd_set readfds;
 
     /* Set width for a select call if needed */
@@ -3273,6 +3321,65 @@ static int www_body(int s, int stype, int prot, unsigned char *context)
                              "HTTP/1.0 200 ok\r\nContent-type: text/plain\r\n\r\n");
             }
             /* send the file */
+#ifndef OPENSSL_NO_KTLS
+            if (use_sendfile_for_req
+                    && !BIO_get_ktls_send(SSL_get_wbio(con))) {
+                BIO_printf(bio_err,
+                           "Warning: sendfile requested but KTLS is not enabled\n");
+                use_sendfile_for_req = 0;
+            }
+            if (use_sendfile_for_req) {
+                FILE *fp = NULL;
+                int fd;
+                struct stat st;
+                off_t offset = 0;
+                size_t filesize;
+                ossl_ssize_t sent;
+                fd_set writefds;
+
+                BIO_get_fp(file, &fp);
+                fd = fileno(fp);
+                if (fstat(fd, &st) < 0) {
+                    BIO_printf(io, "Error fstat '%s'\r\n", p);
+                    ERR_print_errors(io);
+                    goto write_error;
+                }
+
+                /* the headers are still in |io| and have to go first */
+                if (BIO_flush(io) <= 0)
+                    goto write_error;
+
+                filesize = st.st_size;
+                while (filesize > 0) {
+                    sent = SSL_sendfile(con, fd, offset, filesize, 0);
+                    if (sent == 0) {
+                        /* The file has shrunk since we looked at its size */
+                        BIO_printf(bio_err, "Unexpected EOF in '%s'\n", p);
+                        goto write_error;
+                    }
+                    if (sent < 0) {
+                        if (SSL_get_error(con, (int)sent)
+                                == SSL_ERROR_WANT_WRITE) {
+                            BIO_printf(bio_s_out, "rwrite W BLOCK\n");
+                            /* Wait for the socket to drain */
+                            FD_ZERO(&writefds);
+                            openssl_fdset(s, &writefds);
+                            if (select(width, NULL, (void *)&writefds, NULL,
+                                       NULL) > 0)
+                                continue;
+                            BIO_printf(bio_err,
+                                       "Error waiting for socket '%s'\n", p);
+                            break;
+                        }
+                        BIO_printf(bio_err, "Error SSL_sendfile '%s'\n", p);
+                        ERR_print_errors(bio_err);
+                        break;
+                    }
+                    offset += sent;
+                    filesize -= sent;
+                }
+            } else
+#endif
             for (;;) {
                 i = BIO_read(file, buf, bufsize);
                 if (i <= 0)
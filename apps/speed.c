@@ -116,6 +116,11 @@
 #define MAX_MISALIGNMENT 63
 #define MAX_ECDH_SIZE   256
 #define MISALIGN        64
+#define MAX_PIPELINES   32
+/* Explicit IV and tag around the payload of a TLS 1.2 AEAD record */
+#define PIPELINE_RECORD_OVERHEAD (EVP_GCM_TLS_EXPLICIT_IV_LEN \
+                                  + EVP_GCM_TLS_TAG_LEN)
+#define PIPELINE_MAX_RECORD 16384
 
 typedef struct openssl_speed_sec_st {
     int sym;
@@ -172,6 +177,7 @@ static int RAND_bytes_loop(void *args);
 static int EVP_Update_loop(void *args);
 static int EVP_Update_loop_ccm(void *args);
 static int EVP_Update_loop_aead(void *args);
+static int EVP_Update_loop_pipeline(void *args);
 static int EVP_Digest_loop(void *args);
 #ifndef OPENSSL_NO_RSA
 static int RSA_sign_loop(void *args);
@@ -300,7 +306,7 @@ typedef enum OPTION_choice {
     OPT_ERR = -1, OPT_EOF = 0, OPT_HELP,
     OPT_ELAPSED, OPT_EVP, OPT_DECRYPT, OPT_ENGINE, OPT_MULTI,
     OPT_MR, OPT_MB, OPT_MISALIGN, OPT_ASYNCJOBS, OPT_R_ENUM,
-    OPT_PRIMES, OPT_SECONDS, OPT_BYTES, OPT_AEAD
+    OPT_PRIMES, OPT_SECONDS, OPT_BYTES, OPT_AEAD, OPT_PIPELINES
 } OPTION_CHOICE;
 
 const OPTIONS speed_options[] = {
@@ -314,6 +320,8 @@ const OPTIONS speed_options[] = {
      "Benchmark EVP-named AEAD cipher in TLS-like sequence"},
     {"mb", OPT_MB, '-',
      "Enable (tls1>=1) multi-block mode on EVP-named cipher"},
+    {"pipelines", OPT_PIPELINES, 'p',
+     "Encrypt TLS records in pipelines of the specified size (only EVP)"},
     {"mr", OPT_MR, '-', "Produce machine readable output"},
 #ifndef NO_FORK
     {"multi", OPT_MULTI, 'p', "Run benchmarks in parallel"},
@@ -916,6 +924,7 @@ static int RAND_bytes_loop(void *args)
 
 static long save_count = 0;
 static int decrypt = 0;
+static int pipelines = 0;
 static int EVP_Update_loop(void *args)
 {
     loopargs_t *tempargs = *(loopargs_t **) args;
@@ -1023,6 +1032,67 @@ static int EVP_Update_loop_aead(void *args)
     return count;
 }
 
+/*
+ * Encrypt TLS 1.2 records the way the record layer does once
+ * SSL_CTX_set_max_pipelines() is in effect: set up the AAD of each record,
+ * then hand all of them to a single EVP_Cipher() call. The count is in
+ * records, not calls.
+ */
+static int EVP_Update_loop_pipeline(void *args)
+{
+    loopargs_t *tempargs = *(loopargs_t **) args;
+    EVP_CIPHER_CTX *ctx = tempargs->ctx;
+    unsigned char *bufs[MAX_PIPELINES];
+    size_t lens[MAX_PIPELINES];
+    unsigned char aad[EVP_AEAD_TLS1_AAD_LEN];
+    size_t eivlen = 0, reclen;
+    int count, k, pad;
+#ifndef SIGALRM
+    int nb_iter = save_count * 4 * lengths[0] / lengths[testnum];
+#endif
+
+    if (EVP_CIPHER_CTX_mode(ctx) == EVP_CIPH_GCM_MODE)
+        eivlen = EVP_GCM_TLS_EXPLICIT_IV_LEN;
+    reclen = eivlen + lengths[testnum];
+    for (k = 0; k < pipelines; k++)
+        bufs[k] = tempargs->buf
+                  + k * (lengths[testnum] + PIPELINE_RECORD_OVERHEAD);
+
+    memset(aad, 0, sizeof(aad));
+    aad[8] = 23;                        /* application data */
+    aad[9] = 3;
+    aad[10] = 3;                        /* TLS 1.2 */
+    aad[11] = (unsigned char)(reclen >> 8);
+    aad[12] = (unsigned char)reclen;
+    for (count = 0; COND(nb_iter); count += pipelines) {
+        for (k = 0; k < pipelines; k++) {
+            /* ChaCha20-Poly1305 derives its nonce from the sequence */
+            aad[4] = (unsigned char)((count + k) >> 24);
+            aad[5] = (unsigned char)((count + k) >> 16);
+            aad[6] = (unsigned char)((count + k) >> 8);
+            aad[7] = (unsigned char)(count + k);
+            pad = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_AEAD_TLS1_AAD,
+                                      sizeof(aad), aad);
+            if (pad <= 0)
+                return -1;
+            lens[k] = reclen + pad;
+        }
+        if (pipelines > 1
+                && (EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_SET_PIPELINE_OUTPUT_BUFS,
+                                        pipelines, bufs) <= 0
+                    || EVP_CIPHER_CTX_ctrl(ctx,
+                                           EVP_CTRL_SET_PIPELINE_INPUT_BUFS,
+                                           pipelines, bufs) <= 0
+                    || EVP_CIPHER_CTX_ctrl(ctx,
+                                           EVP_CTRL_SET_PIPELINE_INPUT_LENS,
+                                           pipelines, lens) <= 0))
+            return -1;
+        if (EVP_Cipher(ctx, bufs[0], bufs[0], lens[0]) < 0)
+            return -1;
+    }
+    return count;
+}
+
 static const EVP_MD *evp_md = NULL;
 static int EVP_Digest_loop(void *args)
 {
@@ -1650,6 +1720,15 @@ int speed_main(int argc, char **argv)
         case OPT_AEAD:
             aead = 1;
             break;
+        case OPT_PIPELINES:
+            if (!opt_int(opt_arg(), &pipelines))
+                goto end;
+            if (pipelines > MAX_PIPELINES) {
+                BIO_printf(bio_err, "%s: Maximum number of pipelines is %d\n",
+                           prog, MAX_PIPELINES);
+                goto opterr;
+            }
+            break;
         }
     }
     argc = opt_num_rest();
@@ -1750,6 +1829,23 @@ int speed_main(int argc, char **argv)
             goto end;
         }
     }
+    if (pipelines > 0) {
+        if (evp_cipher == NULL
+                || !(EVP_CIPHER_flags(evp_cipher) & EVP_CIPH_FLAG_AEAD_CIPHER)
+                || !(EVP_CIPHER_flags(evp_cipher) & EVP_CIPH_FLAG_PIPELINE)) {
+            BIO_printf(bio_err, "-pipelines can be used only with a pipeline"
+                                " capable AEAD cipher\n");
+            goto end;
+        } else if (decrypt || aead || multiblock) {
+            BIO_printf(bio_err, "-pipelines cannot be combined with -decrypt,"
+                                " -aead or -mb\n");
+            goto end;
+        } else if (lengths[size_num - 1] > PIPELINE_MAX_RECORD) {
+            BIO_printf(bio_err, "-pipelines needs records of at most %d"
+                                " bytes\n", PIPELINE_MAX_RECORD);
+            goto end;
+        }
+    }
     if (multiblock) {
         if (evp_cipher == NULL) {
             BIO_printf(bio_err,"-mb can be used only with a multi-block"
@@ -1790,6 +1886,8 @@ int speed_main(int argc, char **argv)
         }
 
         buflen = lengths[size_num - 1];
+        if (pipelines > 0)
+            buflen = pipelines * (buflen + PIPELINE_RECORD_OVERHEAD);
         if (buflen < 36)    /* size of random vector in RSA benchmark */
             buflen = 36;
         buflen += MAX_MISALIGNMENT + 1;
@@ -2612,7 +2710,9 @@ int speed_main(int argc, char **argv)
 
             names[D_EVP] = OBJ_nid2ln(EVP_CIPHER_nid(evp_cipher));
 
-            if (EVP_CIPHER_mode(evp_cipher) == EVP_CIPH_CCM_MODE) {
+            if (pipelines > 0) {
+                loopfunc = EVP_Update_loop_pipeline;
+            } else if (EVP_CIPHER_mode(evp_cipher) == EVP_CIPH_CCM_MODE) {
                 loopfunc = EVP_Update_loop_ccm;
             } else if (aead && (EVP_CIPHER_flags(evp_cipher) &
                                 EVP_CIPH_FLAG_AEAD_CIPHER)) {
@@ -2652,6 +2752,18 @@ int speed_main(int argc, char **argv)
                         exit(1);
                     }
                     OPENSSL_clear_free(loopargs[k].key, keylen);
+
+                    /* TLS 1.2 GCM records carry their own explicit IV */
+                    if (pipelines > 0
+                            && EVP_CIPHER_mode(evp_cipher) == EVP_CIPH_GCM_MODE
+                            && !EVP_CIPHER_CTX_ctrl(loopargs[k].ctx,
+                                                    EVP_CTRL_GCM_SET_IV_FIXED,
+                                                    EVP_GCM_TLS_FIXED_IV_LEN,
+                                                    iv)) {
+                        BIO_printf(bio_err, "\nEVP_CIPHER_CTX_ctrl failure\n");
+                        ERR_print_errors(bio_err);
+                        exit(1);
+                    }
                 }
 
                 Time_F(START);
@@ -7,6 +7,10 @@
  * https://www.openssl.org/source/license.html
  */
 
+#ifndef _GNU_SOURCE
+# define _GNU_SOURCE            /* make sure recvmmsg() and sendmmsg() are declared */
+#endif
+
 #include <stdio.h>
 #include <errno.h>
 
@@ -28,6 +32,11 @@
 #  define IPPROTO_IPV6 41       /* windows is lame */
 # endif
 
+/* Batched datagram I/O needs recvmmsg() and sendmmsg() */
+# if defined(OPENSSL_SYS_LINUX) && defined(MSG_WAITFORONE)
+#  define OPENSSL_DGRAM_BATCH
+# endif
+
 # if defined(__FreeBSD__) && defined(IN6_IS_ADDR_V4MAPPED)
 /* Standard definition causes type-punning problems. */
 #  undef IN6_IS_ADDR_V4MAPPED
@@ -99,6 +108,28 @@ static const BIO_METHOD methods_dgramp_sctp = {
 };
 # endif
 
+# ifdef OPENSSL_DGRAM_BATCH
+/*
+ * In batch mode up to |max| datagrams are received with one recvmmsg() call
+ * and handed out one per read, and written datagrams are queued and sent
+ * with one sendmmsg() call when the queue is full or the BIO is flushed. Each
+ * datagram has a slot of BIO_DGRAM_BATCH_SLOT bytes, which is enough for any
+ * DTLS record.
+ */
+#  define BIO_DGRAM_BATCH_MAX   64
+#  define BIO_DGRAM_BATCH_SLOT  (16384 + 2048)
+
+typedef struct bio_dgram_batch_st {
+    unsigned char *buf;
+    struct mmsghdr *msgs;
+    struct iovec *iov;
+    BIO_ADDR *peers;
+    /* Datagrams received or queued, and the next one to read or send */
+    unsigned int num;
+    unsigned int next;
+} bio_dgram_batch;
+# endif
+
 typedef struct bio_dgram_data_st {
     BIO_ADDR peer;
     unsigned int connected;
@@ -107,6 +138,12 @@ typedef struct bio_dgram_data_st {
     struct timeval next_timeout;
     struct timeval socket_timeout;
     unsigned int peekmode;
+# ifdef OPENSSL_DGRAM_BATCH
+    /* Datagrams per syscall in batch mode, 0 if not batching */
+    unsigned int batch;
+    bio_dgram_batch *rbatch;
+    bio_dgram_batch *wbatch;
+# endif
 } bio_dgram_data;
 
 # ifndef OPENSSL_NO_SCTP
@@ -160,6 +197,75 @@ static int dgram_new(BIO *bi)
     return 1;
 }
 
+# ifdef OPENSSL_DGRAM_BATCH
+static int dgram_batch_flush(BIO *b);
+
+static void dgram_batch_free(bio_dgram_batch *batch)
+{
+    if (batch == NULL)
+        return;
+    OPENSSL_free(batch->buf);
+    OPENSSL_free(batch->msgs);
+    OPENSSL_free(batch->iov);
+    OPENSSL_free(batch->peers);
+    OPENSSL_free(batch);
+}
+
+static bio_dgram_batch *dgram_batch_new(unsigned int max)
+{
+    bio_dgram_batch *batch = OPENSSL_zalloc(sizeof(*batch));
+
+    if (batch == NULL
+            || (batch->buf = OPENSSL_malloc(max * BIO_DGRAM_BATCH_SLOT)) == NULL
+            || (batch->msgs = OPENSSL_zalloc(max * sizeof(*batch->msgs))) == NULL
+            || (batch->iov = OPENSSL_zalloc(max * sizeof(*batch->iov))) == NULL
+            || (batch->peers = OPENSSL_zalloc(max * sizeof(*batch->peers)))
+               == NULL) {
+        dgram_batch_free(batch);
+        BIOerr(BIO_F_DGRAM_BATCH_NEW, ERR_R_MALLOC_FAILURE);
+        return NULL;
+    }
+    return batch;
+}
+
+/*
+ * Switch batch mode to |max| datagrams per syscall, or off if |max| is 0 or
+ * 1. Datagrams that were already received are kept, and queued ones are sent
+ * first.
+ */
+static int dgram_set_batch(BIO *b, long max)
+{
+    bio_dgram_data *data = (bio_dgram_data *)b->ptr;
+
+    if (max < 0 || max > BIO_DGRAM_BATCH_MAX)
+        return 0;
+    if (max == 1)
+        max = 0;
+    if ((unsigned int)max == data->batch)
+        return 1;
+    if (data->wbatch != NULL && data->wbatch->num > 0 && dgram_batch_flush(b) <= 0)
+        return 0;
+    if (data->rbatch != NULL && data->rbatch->next < data->rbatch->num)
+        return 0;
+
+    dgram_batch_free(data->rbatch);
+    dgram_batch_free(data->wbatch);
+    data->rbatch = data->wbatch = NULL;
+    data->batch = 0;
+    if (max == 0)
+        return 1;
+
+    if ((data->rbatch = dgram_batch_new(max)) == NULL
+            || (data->wbatch = dgram_batch_new(max)) == NULL) {
+        dgram_batch_free(data->rbatch);
+        data->rbatch = NULL;
+        return 0;
+    }
+    data->batch = (unsigned int)max;
+    return 1;
+}
+# endif
+
 static int dgram_free(BIO *a)
 {
     bio_dgram_data *data;
@@ -170,6 +276,10 @@ static int dgram_free(BIO *a)
         return 0;
 
     data = (bio_dgram_data *)a->ptr;
+# ifdef OPENSSL_DGRAM_BATCH
+    dgram_batch_free(data->rbatch);
+    dgram_batch_free(data->wbatch);
+# endif
     OPENSSL_free(data);
 
     return 1;
@@ -294,6 +404,120 @@ static void dgram_reset_rcv_timeout(BIO *b)
 # endif
 }
 
+# ifdef OPENSSL_DGRAM_BATCH
+/* Hand out the next received datagram, receiving a new batch if needed */
+static int dgram_batch_read(BIO *b, char *out, int outl)
+{
+    bio_dgram_data *data = (bio_dgram_data *)b->ptr;
+    bio_dgram_batch *batch = data->rbatch;
+    struct mmsghdr *msg;
+    unsigned int i;
+    int ret;
+
+    if (batch->next >= batch->num) {
+        batch->num = batch->next = 0;
+        for (i = 0; i < data->batch; i++) {
+            batch->iov[i].iov_base = batch->buf + i * BIO_DGRAM_BATCH_SLOT;
+            batch->iov[i].iov_len = BIO_DGRAM_BATCH_SLOT;
+            memset(&batch->msgs[i], 0, sizeof(batch->msgs[i]));
+            batch->msgs[i].msg_hdr.msg_iov = &batch->iov[i];
+            batch->msgs[i].msg_hdr.msg_iovlen = 1;
+            batch->msgs[i].msg_hdr.msg_name =
+                BIO_ADDR_sockaddr_noconst(&batch->peers[i]);
+            batch->msgs[i].msg_hdr.msg_namelen = sizeof(batch->peers[i]);
+        }
+
+        clear_socket_error();
+        dgram_adjust_rcv_timeout(b);
+        ret = recvmmsg(b->num, batch->msgs, data->batch, MSG_WAITFORONE,
+                       NULL);
+        BIO_clear_retry_flags(b);
+        if (ret < 0) {
+            if (BIO_dgram_should_retry(ret)) {
+                BIO_set_retry_read(b);
+                data->_errno = get_last_socket_error();
+            }
+        } else {
+            batch->num = (unsigned int)ret;
+        }
+        dgram_reset_rcv_timeout(b);
+        if (ret <= 0)
+            return ret;
+    }
+
+    msg = &batch->msgs[batch->next];
+    ret = (int)msg->msg_len;
+    if (ret > outl)
+        ret = outl;
+    memcpy(out, batch->iov[batch->next].iov_base, ret);
+    if (!data->connected)
+        BIO_ctrl(b, BIO_CTRL_DGRAM_SET_PEER, 0, &batch->peers[batch->next]);
+    if (!data->peekmode)
+        batch->next++;
+    BIO_clear_retry_flags(b);
+    return ret;
+}
+
+/* Send the queued datagrams, returns 1 once they have all gone out */
+static int dgram_batch_flush(BIO *b)
+{
+    bio_dgram_data *data = (bio_dgram_data *)b->ptr;
+    bio_dgram_batch *batch = data->wbatch;
+    int ret;
+
+    BIO_clear_retry_flags(b);
+    while (batch->next < batch->num) {
+        clear_socket_error();
+        ret = sendmmsg(b->num, &batch->msgs[batch->next],
+                       batch->num - batch->next, 0);
+        if (ret <= 0) {
+            if (BIO_dgram_should_retry(ret)) {
+                BIO_set_retry_write(b);
+                data->_errno = get_last_socket_error();
+            } else {
+                /* Drop the datagram that failed, as a failed sendto() would */
+                data->_errno = get_last_socket_error();
+                batch->next++;
+            }
+            return ret < 0 ? ret : -1;
+        }
+        batch->next += (unsigned int)ret;
+    }
+    batch->num = batch->next = 0;
+    return 1;
+}
+
+/* Queue a datagram, sending the queue first if it is full */
+static int dgram_batch_write(BIO *b, const char *in, int inl)
+{
+    bio_dgram_data *data = (bio_dgram_data *)b->ptr;
+    bio_dgram_batch *batch = data->wbatch;
+    struct msghdr *hdr;
+    unsigned int i;
+    int ret;
+
+    if (batch->num == data->batch && (ret = dgram_batch_flush(b)) <= 0)
+        return ret;
+
+    i = batch->num++;
+    batch->iov[i].iov_base = batch->buf + i * BIO_DGRAM_BATCH_SLOT;
+    batch->iov[i].iov_len = inl;
+    memcpy(batch->iov[i].iov_base, in, inl);
+    hdr = &batch->msgs[i].msg_hdr;
+    memset(hdr, 0, sizeof(*hdr));
+    hdr->msg_iov = &batch->iov[i];
+    hdr->msg_iovlen = 1;
+    if (!data->connected) {
+        batch->peers[i] = data->peer;
+        hdr->msg_name = BIO_ADDR_sockaddr_noconst(&batch->peers[i]);
+        hdr->msg_namelen = BIO_ADDR_sockaddr_size(&batch->peers[i]);
+    }
+
+    BIO_clear_retry_flags(b);
+    return inl;
+}
+# endif
+
 static int dgram_read(BIO *b, char *out, int outl)
 {
     int ret = 0;
@@ -303,6 +527,11 @@ static int dgram_read(BIO *b, char *out, int outl)
     BIO_ADDR peer;
     socklen_t len = sizeof(peer);
 
+# ifdef OPENSSL_DGRAM_BATCH
+    if (out != NULL && data->batch > 0)
+        return dgram_batch_read(b, out, outl);
+# endif
+
     if (out != NULL) {
         clear_socket_error();
         memset(&peer, 0, sizeof(peer));
@@ -332,6 +561,17 @@ static int dgram_write(BIO *b, const char *in, int inl)
 {
     int ret;
     bio_dgram_data *data = (bio_dgram_data *)b->ptr;
+
+# ifdef OPENSSL_DGRAM_BATCH
+    if (data->batch > 0) {
+        if (inl >= 0 && inl <= BIO_DGRAM_BATCH_SLOT)
+            return dgram_batch_write(b, in, inl);
+        /* Too large to queue, send it on its own after the queued ones */
+        if (data->wbatch->num > 0 && (ret = dgram_batch_flush(b)) <= 0)
+            return ret;
+    }
+# endif
+
     clear_socket_error();
 
     if (data->connected)
@@ -438,12 +678,43 @@ static long dgram_ctrl(BIO *b, int cmd, long num, void *ptr)
         b->shutdown = (int)num;
         break;
     case BIO_CTRL_PENDING:
+        ret = 0;
+# ifdef OPENSSL_DGRAM_BATCH
+        /* The length of the next datagram already received */
+        if (data->batch > 0 && data->rbatch->next < data->rbatch->num)
+            ret = data->rbatch->msgs[data->rbatch->next].msg_len;
+# endif
+        break;
     case BIO_CTRL_WPENDING:
+        /*
+         * Each write is a datagram of its own, so there is never anything
+         * to add to, even when datagrams are queued in batch mode.
+         */
         ret = 0;
         break;
     case BIO_CTRL_DUP:
+        ret = 1;
+        break;
     case BIO_CTRL_FLUSH:
         ret = 1;
+# ifdef OPENSSL_DGRAM_BATCH
+        if (data->batch > 0 && data->wbatch->num > 0)
+            ret = dgram_batch_flush(b);
+# endif
+        break;
+    case BIO_CTRL_DGRAM_SET_BATCH:
+# ifdef OPENSSL_DGRAM_BATCH
+        ret = dgram_set_batch(b, num);
+# else
+        ret = 0;
+# endif
+        break;
+    case BIO_CTRL_DGRAM_GET_BATCH:
+# ifdef OPENSSL_DGRAM_BATCH
+        ret = data->batch > 0 ? data->batch : 1;
+# else
+        ret = 1;
+# endif
         break;
     case BIO_CTRL_DGRAM_CONNECT:
         BIO_ADDR_make(&data->peer, BIO_ADDR_sockaddr((BIO_ADDR *)ptr));
@@ -12,6 +12,7 @@
 #include <string.h>
 #include <openssl/objects.h>
 #include "internal/comp.h"
+#include "internal/sslcomp.h"
 #include <openssl/err.h>
 #include "crypto/cryptlib.h"
 #include "internal/bio.h"
@@ -42,6 +43,12 @@ static int zlib_stateful_compress_block(COMP_CTX *ctx, unsigned char *out,
 static int zlib_stateful_expand_block(COMP_CTX *ctx, unsigned char *out,
                                       unsigned int olen, unsigned char *in,
                                       unsigned int ilen);
+static int zlib_oneshot_compress_block(COMP_CTX *ctx, unsigned char *out,
+                                       unsigned int olen, unsigned char *in,
+                                       unsigned int ilen);
+static int zlib_oneshot_expand_block(COMP_CTX *ctx, unsigned char *out,
+                                     unsigned int olen, unsigned char *in,
+                                     unsigned int ilen);
 
 /* memory allocations functions for zlib initialisation */
 static void *zlib_zalloc(void *opaque, unsigned int no, unsigned int size)
@@ -67,6 +74,19 @@ static COMP_METHOD zlib_stateful_method = {
     zlib_stateful_expand_block
 };
 
+/*
+ * Each block is a complete zlib stream, independent of any other block
+ * compressed with the same context.
+ */
+static COMP_METHOD zlib_oneshot_method = {
+    NID_zlib_compression,
+    LN_zlib_compression,
+    NULL,
+    NULL,
+    zlib_oneshot_compress_block,
+    zlib_oneshot_expand_block
+};
+
 /*
  * When OpenSSL is built on Windows, we do not want to require that
  * the ZLIB.DLL be available in order for the OpenSSL DLLs to
@@ -84,6 +104,8 @@ static COMP_METHOD zlib_stateful_method = {
 /* Function pointers */
 typedef int (*compress_ft) (Bytef *dest, uLongf * destLen,
                             const Bytef *source, uLong sourceLen);
+typedef int (*uncompress_ft) (Bytef *dest, uLongf * destLen,
+                              const Bytef *source, uLong sourceLen);
 typedef int (*inflateEnd_ft) (z_streamp strm);
 typedef int (*inflate_ft) (z_streamp strm, int flush);
 typedef int (*inflateInit__ft) (z_streamp strm,
@@ -94,6 +116,7 @@ typedef int (*deflateInit__ft) (z_streamp strm, int level,
                                 const char *version, int stream_size);
 typedef const char *(*zError__ft) (int err);
 static compress_ft p_compress = NULL;
+static uncompress_ft p_uncompress = NULL;
 static inflateEnd_ft p_inflateEnd = NULL;
 static inflate_ft p_inflate = NULL;
 static inflateInit__ft p_inflateInit_ = NULL;
@@ -106,6 +129,7 @@ static int zlib_loaded = 0;     /* only attempt to init func pts once */
 static DSO *zlib_dso = NULL;
 
 #  define compress                p_compress
+#  define uncompress              p_uncompress
 #  define inflateEnd              p_inflateEnd
 #  define inflate                 p_inflate
 #  define inflateInit_            p_inflateInit_
@@ -204,6 +228,28 @@ static int zlib_stateful_expand_block(COMP_CTX *ctx, unsigned char *out,
     return olen - state->istream.avail_out;
 }
 
+static int zlib_oneshot_compress_block(COMP_CTX *ctx, unsigned char *out,
+                                       unsigned int olen, unsigned char *in,
+                                       unsigned int ilen)
+{
+    uLongf out_size = olen;
+
+    if (compress(out, &out_size, in, ilen) != Z_OK)
+        return -1;
+    return (int)out_size;
+}
+
+static int zlib_oneshot_expand_block(COMP_CTX *ctx, unsigned char *out,
+                                     unsigned int olen, unsigned char *in,
+                                     unsigned int ilen)
+{
+    uLongf out_size = olen;
+
+    if (uncompress(out, &out_size, in, ilen) != Z_OK)
+        return -1;
+    return (int)out_size;
+}
+
 #endif
 
 COMP_METHOD *COMP_zlib(void)
@@ -226,6 +272,8 @@ COMP_METHOD *COMP_zlib(void)
         zlib_dso = DSO_load(NULL, LIBZ, NULL, 0);
         if (zlib_dso != NULL) {
             p_compress = (compress_ft) DSO_bind_func(zlib_dso, "compress");
+            p_uncompress
+                = (uncompress_ft) DSO_bind_func(zlib_dso, "uncompress");
             p_inflateEnd
                 = (inflateEnd_ft) DSO_bind_func(zlib_dso, "inflateEnd");
             p_inflate = (inflate_ft) DSO_bind_func(zlib_dso, "inflate");
@@ -238,7 +286,7 @@ COMP_METHOD *COMP_zlib(void)
                 = (deflateInit__ft) DSO_bind_func(zlib_dso, "deflateInit_");
             p_zError = (zError__ft) DSO_bind_func(zlib_dso, "zError");
 
-            if (p_compress && p_inflateEnd && p_inflate
+            if (p_compress && p_uncompress && p_inflateEnd && p_inflate
                 && p_inflateInit_ && p_deflateEnd
                 && p_deflate && p_deflateInit_ && p_zError)
                 zlib_loaded++;
@@ -259,6 +307,18 @@ COMP_METHOD *COMP_zlib(void)
     return meth;
 }
 
+COMP_METHOD *COMP_zlib_oneshot(void)
+{
+    COMP_METHOD *meth = COMP_zlib();
+
+#ifdef ZLIB
+    if (meth == &zlib_stateful_method)
+        meth = &zlib_oneshot_method;
+#endif
+
+    return meth;
+}
+
 void comp_zlib_cleanup_int(void)
 {
 #ifdef ZLIB_SHARED
@@ -45,6 +45,7 @@ typedef struct {
     int iv_gen;                 /* It is OK to generate IVs */
     int tls_aad_len;            /* TLS AAD length */
     ctr128_f ctr;
+    EVP_CIPHER_PIPELINE pipe;   /* TLS records to process in one call */
 } EVP_AES_GCM_CTX;
 
 typedef struct {
@@ -2453,7 +2454,7 @@ static const EVP_CIPHER s390x_aes_##keylen##_##mode = {			\
     nid##_##keylen##_##nmode,blocksize,					\
     keylen / 8,								\
     ivlen,								\
-    flags | EVP_CIPH_##MODE##_MODE,					\
+    (flags & ~EVP_CIPH_FLAG_PIPELINE) | EVP_CIPH_##MODE##_MODE,		\
     s390x_aes_##mode##_init_key,					\
     s390x_aes_##mode##_cipher,						\
     NULL,								\
@@ -2860,6 +2861,7 @@ static int aes_gcm_ctrl(EVP_CIPHER_CTX *c, int type, int arg, void *ptr)
         gctx->taglen = -1;
         gctx->iv_gen = 0;
         gctx->tls_aad_len = -1;
+        memset(&gctx->pipe, 0, sizeof(gctx->pipe));
         return 1;
 
     case EVP_CTRL_GET_IVLEN:
@@ -2959,9 +2961,15 @@ static int aes_gcm_ctrl(EVP_CIPHER_CTX *c, int type, int arg, void *ptr)
             c->buf[arg - 2] = len >> 8;
             c->buf[arg - 1] = len & 0xff;
         }
+        evp_cipher_pipeline_add_aad(&gctx->pipe, ptr);
         /* Extra padding: tag appended to record */
         return EVP_GCM_TLS_TAG_LEN;
 
+    case EVP_CTRL_SET_PIPELINE_OUTPUT_BUFS:
+    case EVP_CTRL_SET_PIPELINE_INPUT_BUFS:
+    case EVP_CTRL_SET_PIPELINE_INPUT_LENS:
+        return evp_cipher_pipeline_ctrl(&gctx->pipe, type, arg, ptr);
+
     case EVP_CTRL_COPY:
         {
             EVP_CIPHER_CTX *out = ptr;
@@ -3195,6 +3203,10 @@ static int aes_gcm_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
     if (!gctx->key_set)
         return -1;
 
+    if (gctx->pipe.numpipes > 0)
+        return evp_cipher_pipeline_cipher(ctx, &gctx->pipe);
+    gctx->pipe.aadctr = 0;
+
     if (gctx->tls_aad_len >= 0)
         return aes_gcm_tls_cipher(ctx, out, in, len);
 
@@ -3318,11 +3330,14 @@ static int aes_gcm_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
                 | EVP_CIPH_CUSTOM_COPY | EVP_CIPH_CUSTOM_IV_LENGTH)
 
 BLOCK_CIPHER_custom(NID_aes, 128, 1, 12, gcm, GCM,
-                    EVP_CIPH_FLAG_AEAD_CIPHER | CUSTOM_FLAGS)
+                    EVP_CIPH_FLAG_AEAD_CIPHER | EVP_CIPH_FLAG_PIPELINE
+                    | CUSTOM_FLAGS)
     BLOCK_CIPHER_custom(NID_aes, 192, 1, 12, gcm, GCM,
-                    EVP_CIPH_FLAG_AEAD_CIPHER | CUSTOM_FLAGS)
+                    EVP_CIPH_FLAG_AEAD_CIPHER | EVP_CIPH_FLAG_PIPELINE
+                    | CUSTOM_FLAGS)
     BLOCK_CIPHER_custom(NID_aes, 256, 1, 12, gcm, GCM,
-                    EVP_CIPH_FLAG_AEAD_CIPHER | CUSTOM_FLAGS)
+                    EVP_CIPH_FLAG_AEAD_CIPHER | EVP_CIPH_FLAG_PIPELINE
+                    | CUSTOM_FLAGS)
 
 static int aes_xts_ctrl(EVP_CIPHER_CTX *c, int type, int arg, void *ptr)
 {
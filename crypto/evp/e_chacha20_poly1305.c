@@ -156,6 +156,7 @@ typedef struct {
     struct { uint64_t aad, text; } len;
     int aad, mac_inited, tag_len, nonce_len;
     size_t tls_payload_length;
+    EVP_CIPHER_PIPELINE pipe;   /* TLS records to process in one call */
 } EVP_CHACHA_AEAD_CTX;
 
 #  define NO_TLS_PAYLOAD_LENGTH ((size_t)-1)
@@ -368,6 +369,10 @@ static int chacha20_poly1305_cipher(EVP_CIPHER_CTX *ctx, unsigned char *out,
     EVP_CHACHA_AEAD_CTX *actx = aead_data(ctx);
     size_t rem, plen = actx->tls_payload_length;
 
+    if (actx->pipe.numpipes > 0)
+        return evp_cipher_pipeline_cipher(ctx, &actx->pipe);
+    actx->pipe.aadctr = 0;
+
     if (!actx->mac_inited) {
 #  if !defined(OPENSSL_SMALL_FOOTPRINT)
         if (plen != NO_TLS_PAYLOAD_LENGTH && out != NULL)
@@ -519,6 +524,7 @@ static int chacha20_poly1305_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg,
         actx->nonce_len = 12;
         actx->tls_payload_length = NO_TLS_PAYLOAD_LENGTH;
         memset(actx->tls_aad, 0, POLY1305_BLOCK_SIZE);
+        memset(&actx->pipe, 0, sizeof(actx->pipe));
         return 1;
 
     case EVP_CTRL_COPY:
@@ -598,9 +604,15 @@ static int chacha20_poly1305_ctrl(EVP_CIPHER_CTX *ctx, int type, int arg,
             actx->key.counter[3] = actx->nonce[2] ^ CHACHA_U8TOU32(aad+4);
             actx->mac_inited = 0;
 
+            evp_cipher_pipeline_add_aad(&actx->pipe, ptr);
             return POLY1305_BLOCK_SIZE;         /* tag length */
         }
 
+    case EVP_CTRL_SET_PIPELINE_OUTPUT_BUFS:
+    case EVP_CTRL_SET_PIPELINE_INPUT_BUFS:
+    case EVP_CTRL_SET_PIPELINE_INPUT_LENS:
+        return evp_cipher_pipeline_ctrl(&actx->pipe, type, arg, ptr);
+
     case EVP_CTRL_AEAD_SET_MAC_KEY:
         /* no-op */
         return 1;
@@ -618,7 +630,7 @@ static EVP_CIPHER chacha20_poly1305 = {
     EVP_CIPH_FLAG_AEAD_CIPHER | EVP_CIPH_CUSTOM_IV |
     EVP_CIPH_ALWAYS_CALL_INIT | EVP_CIPH_CTRL_INIT |
     EVP_CIPH_CUSTOM_COPY | EVP_CIPH_FLAG_CUSTOM_CIPHER |
-    EVP_CIPH_CUSTOM_IV_LENGTH,
+    EVP_CIPH_CUSTOM_IV_LENGTH | EVP_CIPH_FLAG_PIPELINE,
     chacha20_poly1305_init_key,
     chacha20_poly1305_cipher,
     chacha20_poly1305_cleanup,
@@ -533,3 +533,75 @@ int EVP_CIPHER_CTX_test_flags(const EVP_CIPHER_CTX *ctx, int flags)
 {
     return (ctx->flags & flags);
 }
+
+/*
+ * Handle the EVP_CTRL_SET_PIPELINE_* controls for an AEAD cipher that
+ * pipelines TLS records through evp_cipher_pipeline_cipher(). Returns -1 for
+ * any other control.
+ */
+int evp_cipher_pipeline_ctrl(EVP_CIPHER_PIPELINE *pl, int type, int arg,
+                             void *ptr)
+{
+    if (arg <= 0 || arg > EVP_MAX_PIPELINES)
+        return 0;
+
+    switch (type) {
+    case EVP_CTRL_SET_PIPELINE_OUTPUT_BUFS:
+        pl->numpipes = arg;
+        pl->outbufs = ptr;
+        return 1;
+
+    case EVP_CTRL_SET_PIPELINE_INPUT_BUFS:
+        pl->numpipes = arg;
+        pl->inbufs = ptr;
+        return 1;
+
+    case EVP_CTRL_SET_PIPELINE_INPUT_LENS:
+        pl->numpipes = arg;
+        pl->lens = ptr;
+        return 1;
+    }
+    return -1;
+}
+
+/* Keep the AAD of a record that may turn out to be part of a pipeline */
+void evp_cipher_pipeline_add_aad(EVP_CIPHER_PIPELINE *pl,
+                                 const unsigned char *aad)
+{
+    if (pl->aadctr < EVP_MAX_PIPELINES)
+        memcpy(pl->tlsaad[pl->aadctr], aad, EVP_AEAD_TLS1_AAD_LEN);
+    if (pl->aadctr <= EVP_MAX_PIPELINES)
+        pl->aadctr++;
+}
+
+/*
+ * Process the records set up through the pipeline controls one after the
+ * other, each with the AAD that was passed for it. The records are handed to
+ * the cipher one at a time, so it takes its usual single record TLS path.
+ * Returns the total length of the output, or -1 if any record fails.
+ */
+int evp_cipher_pipeline_cipher(EVP_CIPHER_CTX *ctx, EVP_CIPHER_PIPELINE *pl)
+{
+    unsigned char aad[EVP_AEAD_TLS1_AAD_LEN];
+    unsigned int i, n = pl->numpipes;
+    int ret, total = 0;
+
+    pl->numpipes = 0;
+    if (n > EVP_MAX_PIPELINES || pl->aadctr != n
+            || pl->outbufs == NULL || pl->inbufs == NULL || pl->lens == NULL)
+        return -1;
+
+    pl->aadctr = 0;
+    for (i = 0; i < n; i++) {
+        memcpy(aad, pl->tlsaad[i], sizeof(aad));
+        if (ctx->cipher->ctrl(ctx, EVP_CTRL_AEAD_TLS1_AAD, sizeof(aad),
+                              aad) <= 0)
+            return -1;
+        ret = ctx->cipher->do_cipher(ctx, pl->outbufs[i], pl->inbufs[i],
+                                     pl->lens[i]);
+        if (ret < 0)
+            return -1;
+        total += ret;
+    }
+    return total;
+}
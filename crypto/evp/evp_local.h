@@ -66,3 +66,26 @@ typedef struct evp_pbe_st EVP_PBE_CTL;
 DEFINE_STACK_OF(EVP_PBE_CTL)
 
 int is_partially_overlapping(const void *ptr1, const void *ptr2, int len);
+
+/*
+ * Pipeline state for AEAD ciphers that accept the EVP_CTRL_SET_PIPELINE_*
+ * controls. The TLS AAD of each record is kept as it was passed in, so that
+ * every record can be run through the single record TLS path in turn.
+ */
+# define EVP_MAX_PIPELINES 32
+
+typedef struct {
+    unsigned int numpipes;
+    /* Number of EVP_CTRL_AEAD_TLS1_AAD calls since the last cipher call */
+    unsigned int aadctr;
+    unsigned char **outbufs;
+    unsigned char **inbufs;
+    size_t *lens;
+    unsigned char tlsaad[EVP_MAX_PIPELINES][EVP_AEAD_TLS1_AAD_LEN];
+} EVP_CIPHER_PIPELINE;
+
+int evp_cipher_pipeline_ctrl(EVP_CIPHER_PIPELINE *pl, int type, int arg,
+                             void *ptr);
+void evp_cipher_pipeline_add_aad(EVP_CIPHER_PIPELINE *pl,
+                                 const unsigned char *aad);
+int evp_cipher_pipeline_cipher(EVP_CIPHER_CTX *ctx, EVP_CIPHER_PIPELINE *pl);
@@ -40,10 +40,31 @@
 #define UP_LOAD         (2*LH_LOAD_MULT) /* load times 256 (default 2) */
 #define DOWN_LOAD       (LH_LOAD_MULT) /* load times 256 (default 1) */
 
+/*
+ * Lookups only read the table, so that any number of threads holding a read
+ * lock can look up entries without bouncing its cache lines between cores.
+ * Their statistics are therefore only kept when built with LH_RETRIEVE_STATS.
+ */
+#ifdef LH_RETRIEVE_STATS
+# define retrieve_counter(x)    tsan_counter(x)
+#else
+# define retrieve_counter(x)
+#endif
+
 static int expand(OPENSSL_LHASH *lh);
 static void contract(OPENSSL_LHASH *lh);
 static OPENSSL_LH_NODE **getrn(OPENSSL_LHASH *lh, const void *data, unsigned long *rhash);
 
+static ossl_inline unsigned long bucket(const OPENSSL_LHASH *lh,
+                                        unsigned long hash)
+{
+    unsigned long nn = hash % lh->pmax;
+
+    if (nn < lh->p)
+        nn = hash % lh->num_alloc_nodes;
+    return nn;
+}
+
 OPENSSL_LHASH *OPENSSL_LH_new(OPENSSL_LH_HASHFUNC h, OPENSSL_LH_COMPFUNC c)
 {
     OPENSSL_LHASH *ret;
@@ -156,22 +177,24 @@ void *OPENSSL_LH_delete(OPENSSL_LHASH *lh, const void *data)
 void *OPENSSL_LH_retrieve(OPENSSL_LHASH *lh, const void *data)
 {
     unsigned long hash;
-    OPENSSL_LH_NODE **rn;
-    void *ret;
+    OPENSSL_LH_NODE *n1;
 
-    tsan_store((TSAN_QUALIFIER int *)&lh->error, 0);
-
-    rn = getrn(lh, data, &hash);
+    hash = (*(lh->hash)) (data);
+    retrieve_counter(&lh->num_hash_calls);
 
-    if (*rn == NULL) {
-        tsan_counter(&lh->num_retrieve_miss);
-        return NULL;
-    } else {
-        ret = (*rn)->data;
-        tsan_counter(&lh->num_retrieve);
+    for (n1 = lh->b[(int)bucket(lh, hash)]; n1 != NULL; n1 = n1->next) {
+        retrieve_counter(&lh->num_hash_comps);
+        if (n1->hash != hash)
+            continue;
+        retrieve_counter(&lh->num_comp_calls);
+        if (lh->comp(n1->data, data) == 0) {
+            retrieve_counter(&lh->num_retrieve);
+            return n1->data;
+        }
     }
 
-    return ret;
+    retrieve_counter(&lh->num_retrieve_miss);
+    return NULL;
 }
 
 static void doall_util_fn(OPENSSL_LHASH *lh, int use_arg,
@@ -296,19 +319,15 @@ static OPENSSL_LH_NODE **getrn(OPENSSL_LHASH *lh,
                                const void *data, unsigned long *rhash)
 {
     OPENSSL_LH_NODE **ret, *n1;
-    unsigned long hash, nn;
+    unsigned long hash;
     OPENSSL_LH_COMPFUNC cf;
 
     hash = (*(lh->hash)) (data);
     tsan_counter(&lh->num_hash_calls);
     *rhash = hash;
 
-    nn = hash % lh->pmax;
-    if (nn < lh->p)
-        nn = hash % lh->num_alloc_nodes;
-
     cf = lh->comp;
-    ret = &(lh->b[(int)nn]);
+    ret = &(lh->b[(int)bucket(lh, hash)]);
     for (n1 = *ret; n1 != NULL; n1 = n1->next) {
         tsan_counter(&lh->num_hash_comps);
         if (n1->hash != hash) {
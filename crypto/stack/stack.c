@@ -8,7 +8,7 @@
  */
 
 #include <stdio.h>
-#include "internal/cryptlib.h"
+#include "crypto/cryptlib.h"
 #include "internal/numbers.h"
 #include <openssl/stack.h>
 #include <openssl/objects.h>
@@ -27,6 +27,8 @@ struct stack_st {
     int num;
     const void **data;
     int sorted;
+    int frozen;                 /* sorted once and immutable from then on */
+    unsigned int changes;       /* bumped whenever |data| is changed */
     int num_alloc;
     OPENSSL_sk_compfunc comp;
 };
@@ -35,6 +37,8 @@ OPENSSL_sk_compfunc OPENSSL_sk_set_cmp_func(OPENSSL_STACK *sk, OPENSSL_sk_compfu
 {
     OPENSSL_sk_compfunc old = sk->comp;
 
+    if (sk->frozen)
+        return old;
     if (sk->comp != c)
         sk->sorted = 0;
     sk->comp = c;
@@ -53,6 +57,7 @@ OPENSSL_STACK *OPENSSL_sk_dup(const OPENSSL_STACK *sk)
 
     /* direct structure assignment */
     *ret = *sk;
+    ret->frozen = 0;
 
     if (sk->num == 0) {
         /* postpone |ret->data| allocation */
@@ -84,6 +89,7 @@ OPENSSL_STACK *OPENSSL_sk_deep_copy(const OPENSSL_STACK *sk,
 
     /* direct structure assignment */
     *ret = *sk;
+    ret->frozen = 0;
 
     if (sk->num == 0) {
         /* postpone |ret| data allocation */
@@ -226,7 +232,7 @@ OPENSSL_STACK *OPENSSL_sk_new_reserve(OPENSSL_sk_compfunc c, int n)
 
 int OPENSSL_sk_reserve(OPENSSL_STACK *st, int n)
 {
-    if (st == NULL)
+    if (st == NULL || st->frozen)
         return 0;
 
     if (n < 0)
@@ -236,7 +242,7 @@ int OPENSSL_sk_reserve(OPENSSL_STACK *st, int n)
 
 int OPENSSL_sk_insert(OPENSSL_STACK *st, const void *data, int loc)
 {
-    if (st == NULL || st->num == max_nodes)
+    if (st == NULL || st->frozen || st->num == max_nodes)
         return 0;
 
     if (!sk_reserve(st, 1, 0))
@@ -251,6 +257,7 @@ int OPENSSL_sk_insert(OPENSSL_STACK *st, const void *data, int loc)
     }
     st->num++;
     st->sorted = 0;
+    st->changes++;
     return st->num;
 }
 
@@ -262,6 +269,7 @@ static ossl_inline void *internal_delete(OPENSSL_STACK *st, int loc)
          memmove(&st->data[loc], &st->data[loc + 1],
                  sizeof(st->data[0]) * (st->num - loc - 1));
     st->num--;
+    st->changes++;
 
     return (void *)ret;
 }
@@ -270,6 +278,8 @@ void *OPENSSL_sk_delete_ptr(OPENSSL_STACK *st, const void *p)
 {
     int i;
 
+    if (st->frozen)
+        return NULL;
     for (i = 0; i < st->num; i++)
         if (st->data[i] == p)
             return internal_delete(st, i);
@@ -278,7 +288,7 @@ void *OPENSSL_sk_delete_ptr(OPENSSL_STACK *st, const void *p)
 
 void *OPENSSL_sk_delete(OPENSSL_STACK *st, int loc)
 {
-    if (st == NULL || loc < 0 || loc >= st->num)
+    if (st == NULL || st->frozen || loc < 0 || loc >= st->num)
         return NULL;
 
     return internal_delete(st, loc);
@@ -301,8 +311,10 @@ static int internal_find(OPENSSL_STACK *st, const void *data,
     }
 
     if (!st->sorted) {
-        if (st->num > 1)
+        if (st->num > 1) {
             qsort(st->data, st->num, sizeof(void *), st->comp);
+            st->changes++;
+        }
         st->sorted = 1; /* empty or single-element stack is considered sorted */
     }
     if (data == NULL)
@@ -337,24 +349,25 @@ int OPENSSL_sk_unshift(OPENSSL_STACK *st, const void *data)
 
 void *OPENSSL_sk_shift(OPENSSL_STACK *st)
 {
-    if (st == NULL || st->num == 0)
+    if (st == NULL || st->frozen || st->num == 0)
         return NULL;
     return internal_delete(st, 0);
 }
 
 void *OPENSSL_sk_pop(OPENSSL_STACK *st)
 {
-    if (st == NULL || st->num == 0)
+    if (st == NULL || st->frozen || st->num == 0)
         return NULL;
     return internal_delete(st, st->num - 1);
 }
 
 void OPENSSL_sk_zero(OPENSSL_STACK *st)
 {
-    if (st == NULL || st->num == 0)
+    if (st == NULL || st->frozen || st->num == 0)
         return;
     memset(st->data, 0, sizeof(*st->data) * st->num);
     st->num = 0;
+    st->changes++;
 }
 
 void OPENSSL_sk_pop_free(OPENSSL_STACK *st, OPENSSL_sk_freefunc func)
@@ -391,18 +404,21 @@ void *OPENSSL_sk_value(const OPENSSL_STACK *st, int i)
 
 void *OPENSSL_sk_set(OPENSSL_STACK *st, int i, const void *data)
 {
-    if (st == NULL || i < 0 || i >= st->num)
+    if (st == NULL || st->frozen || i < 0 || i >= st->num)
         return NULL;
     st->data[i] = data;
     st->sorted = 0;
+    st->changes++;
     return (void *)st->data[i];
 }
 
 void OPENSSL_sk_sort(OPENSSL_STACK *st)
 {
     if (st != NULL && !st->sorted && st->comp != NULL) {
-        if (st->num > 1)
+        if (st->num > 1) {
             qsort(st->data, st->num, sizeof(void *), st->comp);
+            st->changes++;
+        }
         st->sorted = 1; /* empty or single-element stack is considered sorted */
     }
 }
@@ -411,3 +427,26 @@ int OPENSSL_sk_is_sorted(const OPENSSL_STACK *st)
 {
     return st == NULL ? 1 : st->sorted;
 }
+
+/*
+ * Sort |st| and make it immutable, so that finds on it never have to sort it
+ * and are pure reads that any number of threads can do without a lock.
+ */
+int OPENSSL_sk_freeze(OPENSSL_STACK *st)
+{
+    if (st == NULL)
+        return 0;
+    OPENSSL_sk_sort(st);
+    st->frozen = 1;
+    return 1;
+}
+
+int OPENSSL_sk_is_frozen(const OPENSSL_STACK *st)
+{
+    return st == NULL ? 0 : st->frozen;
+}
+
+unsigned int ossl_sk_changes(const OPENSSL_STACK *st)
+{
+    return st == NULL ? 0 : st->changes;
+}
@@ -222,7 +222,7 @@ const OSSL_STORE_LOADER *ossl_store_get0_loader_int(const char *scheme)
                       ERR_R_MALLOC_FAILURE);
         return NULL;
     }
-    CRYPTO_THREAD_write_lock(registry_lock);
+    CRYPTO_THREAD_read_lock(registry_lock);
 
     loader = lh_OSSL_STORE_LOADER_retrieve(loader_register, &template);
 
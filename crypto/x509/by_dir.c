@@ -16,10 +16,15 @@
 
 #ifndef OPENSSL_NO_POSIX_IO
 # include <sys/stat.h>
+# ifdef _WIN32
+#  define stat _stat
+# endif
 #endif
 
 #include <openssl/x509.h>
 #include "crypto/x509.h"
+#include "crypto/ctype.h"
+#include "internal/o_dir.h"
 #include "x509_local.h"
 
 struct lookup_dir_hashes_st {
@@ -27,16 +32,36 @@ struct lookup_dir_hashes_st {
     int suffix;
 };
 
+/* A certificate or CRL file found when indexing a directory */
+typedef struct lookup_dir_file_st {
+    unsigned long hash;
+    int crl;
+    int suffix;
+    time_t mtime;
+    /* Whether it has been loaded into the store since it last changed */
+    int loaded;
+} BY_DIR_FILE;
+
 struct lookup_dir_entry_st {
     char *dir;
     int dir_type;
     STACK_OF(BY_DIR_HASH) *hashes;
+    /* Index of the directory sorted by hash, type and suffix */
+    BY_DIR_FILE *files;
+    size_t nfiles;
+    time_t indexed;             /* when the index was built, 0 if never */
+    int scanning;               /* threads reading the directory */
 };
 
 typedef struct lookup_dir_st {
     BUF_MEM *buffer;
     STACK_OF(BY_DIR_ENTRY) *dirs;
     CRYPTO_RWLOCK *lock;
+    /*
+     * Seconds an index of a directory is used for, 0 to keep it until the
+     * ttl is set again, or -1 to not index
+     */
+    long index_ttl;
 } BY_DIR;
 
 static int dir_ctrl(X509_LOOKUP *ctx, int cmd, const char *argp, long argl,
@@ -67,7 +92,7 @@ X509_LOOKUP_METHOD *X509_LOOKUP_hash_dir(void)
 static int dir_ctrl(X509_LOOKUP *ctx, int cmd, const char *argp, long argl,
                     char **retp)
 {
-    int ret = 0;
+    int ret = 0, i;
     BY_DIR *ld = (BY_DIR *)ctx->method_data;
 
     switch (cmd) {
@@ -86,6 +111,15 @@ static int dir_ctrl(X509_LOOKUP *ctx, int cmd, const char *argp, long argl,
         } else
             ret = add_cert_dir(ld, argp, (int)argl);
         break;
+    case X509_L_INDEX_DIRS:
+        CRYPTO_THREAD_write_lock(ld->lock);
+        ld->index_ttl = argl < 0 ? -1 : argl;
+        /* Have the next lookup in each directory read it again */
+        for (i = 0; i < sk_BY_DIR_ENTRY_num(ld->dirs); i++)
+            sk_BY_DIR_ENTRY_value(ld->dirs, i)->indexed = 0;
+        CRYPTO_THREAD_unlock(ld->lock);
+        ret = 1;
+        break;
     }
     return ret;
 }
@@ -104,6 +138,7 @@ static int new_dir(X509_LOOKUP *lu)
         goto err;
     }
     a->dirs = NULL;
+    a->index_ttl = -1;
     a->lock = CRYPTO_THREAD_lock_new();
     if (a->lock == NULL) {
         BUF_MEM_free(a->buffer);
@@ -137,6 +172,7 @@ static void by_dir_entry_free(BY_DIR_ENTRY *ent)
 {
     OPENSSL_free(ent->dir);
     sk_BY_DIR_HASH_pop_free(ent->hashes, by_dir_hash_free);
+    OPENSSL_free(ent->files);
     OPENSSL_free(ent);
 }
 
@@ -192,6 +228,10 @@ static int add_cert_dir(BY_DIR *ctx, const char *dir, int type)
                 return 0;
             }
             ent->dir_type = type;
+            ent->files = NULL;
+            ent->nfiles = 0;
+            ent->indexed = 0;
+            ent->scanning = 0;
             ent->hashes = sk_BY_DIR_HASH_new(by_dir_hash_cmp);
             ent->dir = OPENSSL_strndup(ss, len);
             if (ent->dir == NULL || ent->hashes == NULL) {
@@ -208,37 +248,417 @@ static int add_cert_dir(BY_DIR *ctx, const char *dir, int type)
     return 1;
 }
 
+/* Put the name of file |suffix| for |h| in |ent| into |b| */
+static int by_dir_file_name(BUF_MEM *b, const BY_DIR_ENTRY *ent,
+                            unsigned long h, int crl, int suffix)
+{
+    const char *postfix = crl ? "r" : "";
+    char c = '/';
+
+    if (!BUF_MEM_grow(b, strlen(ent->dir) + 1 + 8 + 6 + 1 + 1)) {
+        X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+#ifdef OPENSSL_SYS_VMS
+    c = ent->dir[strlen(ent->dir) - 1];
+    if (c != ':' && c != '>' && c != ']') {
+        /*
+         * If no separator is present, we assume the directory
+         * specifier is a logical name, and add a colon.  We really
+         * should use better VMS routines for merging things like
+         * this, but this will do for now... -- Richard Levitte
+         */
+        c = ':';
+    } else {
+        c = '\0';
+    }
+#endif
+    if (c == '\0') {
+        /*
+         * This is special.  When c == '\0', no directory separator
+         * should be added.
+         */
+        BIO_snprintf(b->data, b->max,
+                     "%s%08lx.%s%d", ent->dir, h, postfix, suffix);
+    } else {
+        BIO_snprintf(b->data, b->max,
+                     "%s%c%08lx.%s%d", ent->dir, c, h, postfix, suffix);
+    }
+    return 1;
+}
+
+/* Returns 1 if the file exists, and its modification time if known */
+static int by_dir_file_stat(const char *file, time_t *mtime)
+{
+#ifndef OPENSSL_NO_POSIX_IO
+    struct stat st;
+
+    if (stat(file, &st) < 0)
+        return 0;
+    *mtime = st.st_mtime;
+#else
+    *mtime = 0;
+#endif
+    return 1;
+}
+
+/* Parse a file name of the form <hash>.<suffix> or <hash>.r<suffix> */
+static int by_dir_parse_file_name(const char *name, BY_DIR_FILE *f)
+{
+    unsigned long h = 0;
+    long suffix = 0;
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        if (ossl_isdigit(name[i]))
+            h = (h << 4) | (name[i] - '0');
+        else if (name[i] >= 'a' && name[i] <= 'f')
+            h = (h << 4) | (name[i] - 'a' + 10);
+        else
+            return 0;
+    }
+    name += 8;
+    if (*name++ != '.')
+        return 0;
+    f->crl = *name == 'r';
+    if (f->crl)
+        name++;
+    if (*name == '\0')
+        return 0;
+    for (; *name != '\0'; name++) {
+        if (!ossl_isdigit(*name) || suffix > (INT_MAX - 9) / 10)
+            return 0;
+        suffix = suffix * 10 + (*name - '0');
+    }
+    f->hash = h;
+    f->suffix = (int)suffix;
+    f->mtime = 0;
+    f->loaded = 0;
+    return 1;
+}
+
+static int by_dir_file_cmp(const void *a, const void *b)
+{
+    const BY_DIR_FILE *fa = a, *fb = b;
+
+    if (fa->hash != fb->hash)
+        return fa->hash < fb->hash ? -1 : 1;
+    if (fa->crl != fb->crl)
+        return fa->crl - fb->crl;
+    if (fa->suffix != fb->suffix)
+        return fa->suffix < fb->suffix ? -1 : 1;
+    return 0;
+}
+
+/* Find the first file for |h| of the given type in the index of |ent| */
+static size_t by_dir_find_file(const BY_DIR_ENTRY *ent, unsigned long h,
+                               int crl)
+{
+    BY_DIR_FILE key;
+    size_t lo = 0, hi = ent->nfiles, mid;
+
+    key.hash = h;
+    key.crl = crl;
+    key.suffix = -1;
+    while (lo < hi) {
+        mid = lo + (hi - lo) / 2;
+        if (by_dir_file_cmp(&ent->files[mid], &key) < 0)
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    return lo;
+}
+
+/*
+ * Read the directory of |ent| into a new index in |*pfiles|, sorted by hash,
+ * type and suffix. Only uses the directory name, which never changes, so it
+ * is called without the lock held.
+ */
+static int by_dir_scan(const BY_DIR_ENTRY *ent, BUF_MEM *b,
+                       BY_DIR_FILE **pfiles, size_t *pnfiles)
+{
+    OPENSSL_DIR_CTX *d = NULL;
+    const char *fn;
+    BY_DIR_FILE *files = NULL, *tmp, f;
+    size_t n = 0, max = 0;
+
+    while ((fn = OPENSSL_DIR_read(&d, ent->dir)) != NULL) {
+        if (!by_dir_parse_file_name(fn, &f)
+                || !by_dir_file_name(b, ent, f.hash, f.crl, f.suffix)
+                || !by_dir_file_stat(b->data, &f.mtime))
+            continue;
+        if (n == max) {
+            max = max == 0 ? 64 : max * 2;
+            tmp = OPENSSL_realloc(files, max * sizeof(*files));
+            if (tmp == NULL) {
+                OPENSSL_DIR_end(&d);
+                OPENSSL_free(files);
+                X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
+                return 0;
+            }
+            files = tmp;
+        }
+        files[n++] = f;
+    }
+    if (d != NULL)
+        OPENSSL_DIR_end(&d);
+    if (n > 0)
+        qsort(files, n, sizeof(*files), by_dir_file_cmp);
+    *pfiles = files;
+    *pnfiles = n;
+    return 1;
+}
+
+/*
+ * Replace the index of |ent| with |files|. Files that have not changed since
+ * they were loaded keep being marked as loaded. Must be called with the lock
+ * held for writing.
+ */
+static void by_dir_swap_index(BY_DIR_ENTRY *ent, BY_DIR_FILE *files, size_t n,
+                              time_t now)
+{
+    BY_DIR_FILE *old;
+    size_t i, j;
+
+    for (i = 0, j = 0; i < n && j < ent->nfiles; ) {
+        old = &ent->files[j];
+        switch (by_dir_file_cmp(&files[i], old)) {
+        case 0:
+            if (old->mtime == files[i].mtime)
+                files[i].loaded = old->loaded;
+            i++;
+            j++;
+            break;
+        case -1:
+            i++;
+            break;
+        default:
+            j++;
+            break;
+        }
+    }
+    OPENSSL_free(ent->files);
+    ent->files = files;
+    ent->nfiles = n;
+    ent->indexed = now;
+}
+
+/* Must be called with the lock held */
+static int by_dir_index_fresh(const BY_DIR *ctx, const BY_DIR_ENTRY *ent,
+                              time_t now)
+{
+    if (ent->indexed == 0)
+        return 0;
+    return ctx->index_ttl == 0
+           || (now >= ent->indexed && now - ent->indexed < ctx->index_ttl);
+}
+
+/*
+ * Make sure |ent| has an index that has not expired. The directory is read
+ * without the lock held. While one thread does that, others keep using the
+ * expired index rather than reading the directory as well.
+ */
+static int by_dir_index(BY_DIR *ctx, BY_DIR_ENTRY *ent, BUF_MEM *b, time_t now)
+{
+    BY_DIR_FILE *files;
+    size_t n;
+    int ok;
+
+    CRYPTO_THREAD_read_lock(ctx->lock);
+    ok = by_dir_index_fresh(ctx, ent, now)
+         || (ent->scanning > 0 && ent->indexed != 0);
+    CRYPTO_THREAD_unlock(ctx->lock);
+    if (ok)
+        return 1;
+
+    CRYPTO_THREAD_write_lock(ctx->lock);
+    if (by_dir_index_fresh(ctx, ent, now)
+            || (ent->scanning > 0 && ent->indexed != 0)) {
+        CRYPTO_THREAD_unlock(ctx->lock);
+        return 1;
+    }
+    ent->scanning++;
+    CRYPTO_THREAD_unlock(ctx->lock);
+
+    ok = by_dir_scan(ent, b, &files, &n);
+
+    CRYPTO_THREAD_write_lock(ctx->lock);
+    ent->scanning--;
+    if (ok)
+        by_dir_swap_index(ent, files, n, now);
+    CRYPTO_THREAD_unlock(ctx->lock);
+    return ok;
+}
+
+/*
+ * Load the files for |h| of the given type that the index of |ent| lists
+ * and that have not been loaded since they last changed. Lookups that find
+ * nothing new to load only take the lock for reading and do not touch the
+ * file system. Files are loaded without the lock held, so two threads may
+ * load the same file, which the store ignores the second time.
+ */
+static int by_dir_load_indexed(X509_LOOKUP *xl, BY_DIR *ctx,
+                               BY_DIR_ENTRY *ent, BUF_MEM *b,
+                               unsigned long h, int crl)
+{
+    BY_DIR_FILE *pending = NULL, *f;
+    size_t first, i, j, n = 0;
+    int ok = 1;
+
+    if (!by_dir_index(ctx, ent, b, time(NULL)))
+        return 0;
+
+    CRYPTO_THREAD_read_lock(ctx->lock);
+    first = by_dir_find_file(ent, h, crl);
+    for (i = first; i < ent->nfiles && ent->files[i].hash == h
+                        && ent->files[i].crl == crl; i++)
+        if (!ent->files[i].loaded)
+            n++;
+    if (n > 0 && (pending = OPENSSL_malloc(n * sizeof(*pending))) != NULL) {
+        for (i = first, j = 0; j < n; i++)
+            if (!ent->files[i].loaded)
+                pending[j++] = ent->files[i];
+    }
+    CRYPTO_THREAD_unlock(ctx->lock);
+    if (n == 0)
+        return 1;
+    if (pending == NULL) {
+        X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+
+    for (j = 0; j < n; j++) {
+        if (!by_dir_file_name(b, ent, h, crl, pending[j].suffix)) {
+            ok = 0;
+            n = j;
+            break;
+        }
+        if (crl)
+            X509_load_crl_file(xl, b->data, ent->dir_type);
+        else
+            X509_load_cert_file(xl, b->data, ent->dir_type);
+    }
+
+    /*
+     * Don't retry files that fail to load until they change. The index may
+     * have been rebuilt meanwhile, so match the files up again.
+     */
+    CRYPTO_THREAD_write_lock(ctx->lock);
+    i = by_dir_find_file(ent, h, crl);
+    for (j = 0; j < n; j++) {
+        for (; i < ent->nfiles; i++) {
+            f = &ent->files[i];
+            if (by_dir_file_cmp(f, &pending[j]) >= 0)
+                break;
+        }
+        if (i < ent->nfiles && by_dir_file_cmp(f, &pending[j]) == 0
+                && f->mtime == pending[j].mtime)
+            f->loaded = 1;
+    }
+    CRYPTO_THREAD_unlock(ctx->lock);
+    OPENSSL_free(pending);
+    return ok;
+}
+
+/*
+ * Load the files for |h| of the given type from |ent| by probing for them,
+ * starting after the last CRL file found by an earlier lookup.
+ */
+static int by_dir_load_probed(X509_LOOKUP *xl, BY_DIR *ctx,
+                              BY_DIR_ENTRY *ent, BUF_MEM *b,
+                              unsigned long h, int crl)
+{
+    int idx, k;
+    BY_DIR_HASH htmp, *hent;
+    time_t mtime;
+
+    if (crl && ent->hashes) {
+        htmp.hash = h;
+        CRYPTO_THREAD_read_lock(ctx->lock);
+        idx = sk_BY_DIR_HASH_find(ent->hashes, &htmp);
+        if (idx >= 0) {
+            hent = sk_BY_DIR_HASH_value(ent->hashes, idx);
+            k = hent->suffix;
+        } else {
+            hent = NULL;
+            k = 0;
+        }
+        CRYPTO_THREAD_unlock(ctx->lock);
+    } else {
+        k = 0;
+        hent = NULL;
+    }
+    for (;;) {
+        if (!by_dir_file_name(b, ent, h, crl, k))
+            return 0;
+        if (!by_dir_file_stat(b->data, &mtime))
+            break;
+        /* found one. */
+        if (crl) {
+            if ((X509_load_crl_file(xl, b->data, ent->dir_type)) == 0)
+                break;
+        } else {
+            if ((X509_load_cert_file(xl, b->data, ent->dir_type)) == 0)
+                break;
+        }
+        k++;
+    }
+
+    /* If a CRL, update the last file suffix added for this */
+
+    if (crl) {
+        CRYPTO_THREAD_write_lock(ctx->lock);
+        /*
+         * Look for entry again in case another thread added an entry
+         * first.
+         */
+        if (hent == NULL) {
+            htmp.hash = h;
+            idx = sk_BY_DIR_HASH_find(ent->hashes, &htmp);
+            hent = sk_BY_DIR_HASH_value(ent->hashes, idx);
+        }
+        if (hent == NULL) {
+            hent = OPENSSL_malloc(sizeof(*hent));
+            if (hent == NULL) {
+                CRYPTO_THREAD_unlock(ctx->lock);
+                X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
+                return 0;
+            }
+            hent->hash = h;
+            hent->suffix = k;
+            if (!sk_BY_DIR_HASH_push(ent->hashes, hent)) {
+                CRYPTO_THREAD_unlock(ctx->lock);
+                OPENSSL_free(hent);
+                X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
+                return 0;
+            }
+        } else if (hent->suffix < k) {
+            hent->suffix = k;
+        }
+
+        CRYPTO_THREAD_unlock(ctx->lock);
+    }
+    return 1;
+}
+
 static int get_cert_by_subject(X509_LOOKUP *xl, X509_LOOKUP_TYPE type,
                                X509_NAME *name, X509_OBJECT *ret)
 {
     BY_DIR *ctx;
-    union {
-        X509 st_x509;
-        X509_CRL crl;
-    } data;
     int ok = 0;
-    int i, j, k;
+    int i, crl, indexed;
     unsigned long h;
     BUF_MEM *b = NULL;
-    X509_OBJECT stmp, *tmp;
-    const char *postfix = "";
 
     if (name == NULL)
         return 0;
 
-    stmp.type = type;
-    if (type == X509_LU_X509) {
-        data.st_x509.cert_info.subject = name;
-        stmp.data.x509 = &data.st_x509;
-        postfix = "";
-    } else if (type == X509_LU_CRL) {
-        data.crl.crl.issuer = name;
-        stmp.data.crl = &data.crl;
-        postfix = "r";
-    } else {
+    if (type != X509_LU_X509 && type != X509_LU_CRL) {
         X509err(X509_F_GET_CERT_BY_SUBJECT, X509_R_WRONG_LOOKUP_TYPE);
         goto finish;
     }
+    crl = type == X509_LU_CRL;
 
     if ((b = BUF_MEM_new()) == NULL) {
         X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_BUF_LIB);
@@ -247,133 +667,27 @@ static int get_cert_by_subject(X509_LOOKUP *xl, X509_LOOKUP_TYPE type,
 
     ctx = (BY_DIR *)xl->method_data;
 
+    CRYPTO_THREAD_read_lock(ctx->lock);
+    indexed = ctx->index_ttl >= 0;
+    CRYPTO_THREAD_unlock(ctx->lock);
+
     h = X509_NAME_hash(name);
     for (i = 0; i < sk_BY_DIR_ENTRY_num(ctx->dirs); i++) {
-        BY_DIR_ENTRY *ent;
-        int idx;
-        BY_DIR_HASH htmp, *hent;
-
-        ent = sk_BY_DIR_ENTRY_value(ctx->dirs, i);
-        j = strlen(ent->dir) + 1 + 8 + 6 + 1 + 1;
-        if (!BUF_MEM_grow(b, j)) {
-            X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
-            goto finish;
-        }
-        if (type == X509_LU_CRL && ent->hashes) {
-            htmp.hash = h;
-            CRYPTO_THREAD_read_lock(ctx->lock);
-            idx = sk_BY_DIR_HASH_find(ent->hashes, &htmp);
-            if (idx >= 0) {
-                hent = sk_BY_DIR_HASH_value(ent->hashes, idx);
-                k = hent->suffix;
-            } else {
-                hent = NULL;
-                k = 0;
-            }
-            CRYPTO_THREAD_unlock(ctx->lock);
+        BY_DIR_ENTRY *ent = sk_BY_DIR_ENTRY_value(ctx->dirs, i);
+
+        if (indexed) {
+            if (!by_dir_load_indexed(xl, ctx, ent, b, h, crl))
+                goto finish;
         } else {
-            k = 0;
-            hent = NULL;
-        }
-        for (;;) {
-            char c = '/';
-#ifdef OPENSSL_SYS_VMS
-            c = ent->dir[strlen(ent->dir) - 1];
-            if (c != ':' && c != '>' && c != ']') {
-                /*
-                 * If no separator is present, we assume the directory
-                 * specifier is a logical name, and add a colon.  We really
-                 * should use better VMS routines for merging things like
-                 * this, but this will do for now... -- Richard Levitte
-                 */
-                c = ':';
-            } else {
-                c = '\0';
-            }
-#endif
-            if (c == '\0') {
-                /*
-                 * This is special.  When c == '\0', no directory separator
-                 * should be added.
-                 */
-                BIO_snprintf(b->data, b->max,
-                             "%s%08lx.%s%d", ent->dir, h, postfix, k);
-            } else {
-                BIO_snprintf(b->data, b->max,
-                             "%s%c%08lx.%s%d", ent->dir, c, h, postfix, k);
-            }
-#ifndef OPENSSL_NO_POSIX_IO
-# ifdef _WIN32
-#  define stat _stat
-# endif
-            {
-                struct stat st;
-                if (stat(b->data, &st) < 0)
-                    break;
-            }
-#endif
-            /* found one. */
-            if (type == X509_LU_X509) {
-                if ((X509_load_cert_file(xl, b->data, ent->dir_type)) == 0)
-                    break;
-            } else if (type == X509_LU_CRL) {
-                if ((X509_load_crl_file(xl, b->data, ent->dir_type)) == 0)
-                    break;
-            }
-            /* else case will caught higher up */
-            k++;
+            if (!by_dir_load_probed(xl, ctx, ent, b, h, crl))
+                goto finish;
         }
 
         /*
          * we have added it to the cache so now pull it out again
          */
-        X509_STORE_lock(xl->store_ctx);
-        j = sk_X509_OBJECT_find(xl->store_ctx->objs, &stmp);
-        tmp = sk_X509_OBJECT_value(xl->store_ctx->objs, j);
-        X509_STORE_unlock(xl->store_ctx);
-
-        /* If a CRL, update the last file suffix added for this */
-
-        if (type == X509_LU_CRL) {
-            CRYPTO_THREAD_write_lock(ctx->lock);
-            /*
-             * Look for entry again in case another thread added an entry
-             * first.
-             */
-            if (hent == NULL) {
-                htmp.hash = h;
-                idx = sk_BY_DIR_HASH_find(ent->hashes, &htmp);
-                hent = sk_BY_DIR_HASH_value(ent->hashes, idx);
-            }
-            if (hent == NULL) {
-                hent = OPENSSL_malloc(sizeof(*hent));
-                if (hent == NULL) {
-                    CRYPTO_THREAD_unlock(ctx->lock);
-                    X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
-                    ok = 0;
-                    goto finish;
-                }
-                hent->hash = h;
-                hent->suffix = k;
-                if (!sk_BY_DIR_HASH_push(ent->hashes, hent)) {
-                    CRYPTO_THREAD_unlock(ctx->lock);
-                    OPENSSL_free(hent);
-                    X509err(X509_F_GET_CERT_BY_SUBJECT, ERR_R_MALLOC_FAILURE);
-                    ok = 0;
-                    goto finish;
-                }
-            } else if (hent->suffix < k) {
-                hent->suffix = k;
-            }
-
-            CRYPTO_THREAD_unlock(ctx->lock);
-
-        }
-
-        if (tmp != NULL) {
+        if (x509_store_get0_by_subject(xl->store_ctx, type, name, ret)) {
             ok = 1;
-            ret->type = tmp->type;
-            memcpy(&ret->data, &tmp->data, sizeof(ret->data));
 
             /*
              * Clear any errors that might have been raised processing empty
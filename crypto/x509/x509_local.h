@@ -97,6 +97,9 @@ struct x509_lookup_st {
     X509_STORE *store_ctx;      /* who owns us */
 };
 
+typedef struct x509_store_snapshot_st X509_STORE_SNAPSHOT;
+typedef struct x509_verify_cache_st X509_VERIFY_CACHE;
+
 /*
  * This is used to hold everything.  It is used for all certificate
  * validation.  Once we have a certificate chain, the 'verify' function is
@@ -106,6 +109,12 @@ struct x509_store_st {
     /* The following is a cache of trusted certs */
     int cache;                  /* if true, stash any hits */
     STACK_OF(X509_OBJECT) *objs; /* Cache of all objects */
+    /* Index of |objs| for lookups, rebuilt on demand after any change */
+    X509_STORE_SNAPSHOT *snapshot;
+    /* Bumped whenever |objs| changes, under the write lock */
+    unsigned long generation;
+    /* Optional cache of successfully verified chains */
+    X509_VERIFY_CACHE *vcache;
     /* These are external lookup methods */
     STACK_OF(X509_LOOKUP) *get_cert_methods;
     X509_VERIFY_PARAM *param;
@@ -143,5 +152,16 @@ DEFINE_STACK_OF(BY_DIR_ENTRY)
 typedef STACK_OF(X509_NAME_ENTRY) STACK_OF_X509_NAME_ENTRY;
 DEFINE_STACK_OF(STACK_OF_X509_NAME_ENTRY)
 
+int x509_store_get0_by_subject(X509_STORE *store, X509_LOOKUP_TYPE type,
+                               X509_NAME *name, X509_OBJECT *ret);
+
+int x509_verify_cache_get(X509_STORE_CTX *ctx, unsigned char *key,
+                          unsigned long *generation);
+void x509_verify_cache_put(X509_STORE_CTX *ctx, const unsigned char *key,
+                           unsigned long generation);
+void x509_verify_cache_free(X509_VERIFY_CACHE *cache);
+
+void x509_crl_drop_serial_index(X509_CRL *crl);
+
 void x509_set_signature_info(X509_SIG_INFO *siginf, const X509_ALGOR *alg,
                              const ASN1_STRING *sig);
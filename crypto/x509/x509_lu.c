@@ -41,6 +41,22 @@ void X509_LOOKUP_free(X509_LOOKUP *ctx)
     OPENSSL_free(ctx);
 }
 
+static void x509_store_snapshot_free(X509_STORE_SNAPSHOT *snap);
+
+/*
+ * Called with the write lock held when |s->objs| may have changed: drop the
+ * snapshot indexing it and invalidate any verified chains built from it.
+ */
+static void x509_store_changed(X509_STORE *s)
+{
+    x509_store_snapshot_free(s->snapshot);
+    s->snapshot = NULL;
+    s->generation++;
+}
+
+static int x509_store_snapshot_current(const X509_STORE_SNAPSHOT *snap,
+                                       STACK_OF(X509_OBJECT) *objs);
+
 int X509_STORE_lock(X509_STORE *s)
 {
     return CRYPTO_THREAD_write_lock(s->lock);
@@ -48,6 +64,13 @@ int X509_STORE_lock(X509_STORE *s)
 
 int X509_STORE_unlock(X509_STORE *s)
 {
+    /*
+     * The caller may have changed s->objs through X509_STORE_get0_objects().
+     * Holding the lock to read the store, or to change its settings, must
+     * not throw away the snapshot and everything verified against it.
+     */
+    if (!x509_store_snapshot_current(s->snapshot, s->objs))
+        x509_store_changed(s);
     return CRYPTO_THREAD_unlock(s->lock);
 }
 
@@ -157,6 +180,220 @@ static int x509_object_cmp(const X509_OBJECT *const *a,
     return ret;
 }
 
+/*
+ * A snapshot is an immutable index of the objects in a store, keyed by type
+ * and subject (or CRL issuer) name. Lookups take a reference to the current
+ * snapshot while briefly holding the store lock for reading, and then search
+ * it without any lock held. Adding objects to the store drops the snapshot,
+ * and the next lookup builds a new one, so loading many objects only costs
+ * a single rebuild.
+ *
+ * The objects with the same type and name form a run of |objs|, which is in
+ * the order of the sorted store->objs. Runs are chained from a hash table
+ * of the canonical encoding of the name.
+ */
+typedef struct x509_store_run_st {
+    unsigned long hash;
+    int first;
+    int num;
+    int next;                   /* next run in the same bucket, or -1 */
+} X509_STORE_RUN;
+
+struct x509_store_snapshot_st {
+    X509_OBJECT *objs;          /* each holds a reference to its object */
+    int num;
+    X509_STORE_RUN *runs;
+    int *buckets;
+    size_t mask;
+    CRYPTO_REF_COUNT references;
+    CRYPTO_RWLOCK *lock;
+};
+
+static void x509_object_free_internal(X509_OBJECT *a);
+
+static X509_NAME *x509_object_name(const X509_OBJECT *a)
+{
+    switch (a->type) {
+    case X509_LU_X509:
+        return X509_get_subject_name(a->data.x509);
+    case X509_LU_CRL:
+        return X509_CRL_get_issuer(a->data.crl);
+    case X509_LU_NONE:
+        break;
+    }
+    return NULL;
+}
+
+static unsigned long x509_store_name_hash(X509_LOOKUP_TYPE type,
+                                          X509_NAME *name)
+{
+    unsigned long hash = 2166136261UL ^ (unsigned long)type;
+    int i;
+
+    /* Make sure the canonical encoding is up to date, as X509_NAME_cmp does */
+    if ((name->canon_enc == NULL || name->modified)
+            && i2d_X509_NAME(name, NULL) < 0)
+        return 0;
+    for (i = 0; i < name->canon_enclen; i++) {
+        hash ^= name->canon_enc[i];
+        hash = (hash * 16777619UL) & 0xffffffffUL;
+    }
+    return hash;
+}
+
+static void x509_store_snapshot_free(X509_STORE_SNAPSHOT *snap)
+{
+    int i;
+
+    if (snap == NULL)
+        return;
+    CRYPTO_DOWN_REF(&snap->references, &i, snap->lock);
+    if (i > 0)
+        return;
+    REF_ASSERT_ISNT(i < 0);
+
+    for (i = 0; i < snap->num; i++)
+        x509_object_free_internal(&snap->objs[i]);
+    OPENSSL_free(snap->objs);
+    OPENSSL_free(snap->runs);
+    OPENSSL_free(snap->buckets);
+    CRYPTO_THREAD_lock_free(snap->lock);
+    OPENSSL_free(snap);
+}
+
+/* Build a snapshot of |objs|, which must be locked for writing */
+static X509_STORE_SNAPSHOT *x509_store_snapshot_new(STACK_OF(X509_OBJECT) *objs)
+{
+    X509_STORE_SNAPSHOT *snap = OPENSSL_zalloc(sizeof(*snap));
+    X509_STORE_RUN *run = NULL;
+    X509_OBJECT *obj;
+    size_t nbuckets = 16, b;
+    int i, nruns = 0, num = sk_X509_OBJECT_num(objs);
+
+    if (snap == NULL)
+        return NULL;
+    snap->references = 1;
+    if ((snap->lock = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(snap);
+        return NULL;
+    }
+    while (nbuckets < (size_t)num)
+        nbuckets <<= 1;
+    snap->mask = nbuckets - 1;
+    if ((num > 0 && ((snap->objs = OPENSSL_malloc(num * sizeof(*snap->objs)))
+                         == NULL
+                     || (snap->runs = OPENSSL_malloc(num * sizeof(*snap->runs)))
+                         == NULL))
+            || (snap->buckets = OPENSSL_malloc(nbuckets * sizeof(int))) == NULL)
+        goto err;
+    for (b = 0; b < nbuckets; b++)
+        snap->buckets[b] = -1;
+
+    sk_X509_OBJECT_sort(objs);
+    for (i = 0; i < num; i++) {
+        obj = sk_X509_OBJECT_value(objs, i);
+        if (!X509_OBJECT_up_ref_count(obj))
+            goto err;
+        snap->objs[snap->num++] = *obj;
+
+        if (run != NULL) {
+            const X509_OBJECT *prev = &snap->objs[run->first];
+
+            if (x509_object_cmp(&prev, (const X509_OBJECT **)&obj) == 0) {
+                run->num++;
+                continue;
+            }
+        }
+        run = &snap->runs[nruns];
+        run->hash = x509_store_name_hash(obj->type, x509_object_name(obj));
+        run->first = i;
+        run->num = 1;
+        b = run->hash & snap->mask;
+        run->next = snap->buckets[b];
+        snap->buckets[b] = nruns++;
+    }
+    return snap;
+
+ err:
+    x509_store_snapshot_free(snap);
+    return NULL;
+}
+
+/*
+ * Check whether |snap| still describes |objs|, which must be locked. The
+ * snapshot is taken from the sorted stack, so unless the stack has been
+ * changed since, it holds the same objects in the same order. Without a
+ * snapshot there is nothing to compare against, so assume a change.
+ */
+static int x509_store_snapshot_current(const X509_STORE_SNAPSHOT *snap,
+                                       STACK_OF(X509_OBJECT) *objs)
+{
+    const X509_OBJECT *obj;
+    int i;
+
+    if (snap == NULL || sk_X509_OBJECT_num(objs) != snap->num)
+        return 0;
+    for (i = 0; i < snap->num; i++) {
+        obj = sk_X509_OBJECT_value(objs, i);
+        if (obj->type != snap->objs[i].type
+                || obj->data.ptr != snap->objs[i].data.ptr)
+            return 0;
+    }
+    return 1;
+}
+
+/* Get a reference to the current snapshot of |store|, building it if needed */
+static X509_STORE_SNAPSHOT *x509_store_get1_snapshot(X509_STORE *store)
+{
+    X509_STORE_SNAPSHOT *snap;
+    int i;
+
+    CRYPTO_THREAD_read_lock(store->lock);
+    snap = store->snapshot;
+    if (snap != NULL && CRYPTO_UP_REF(&snap->references, &i, snap->lock) <= 0)
+        snap = NULL;
+    CRYPTO_THREAD_unlock(store->lock);
+    if (snap != NULL)
+        return snap;
+
+    CRYPTO_THREAD_write_lock(store->lock);
+    if (store->snapshot == NULL)
+        store->snapshot = x509_store_snapshot_new(store->objs);
+    snap = store->snapshot;
+    if (snap != NULL && CRYPTO_UP_REF(&snap->references, &i, snap->lock) <= 0)
+        snap = NULL;
+    CRYPTO_THREAD_unlock(store->lock);
+    return snap;
+}
+
+/*
+ * Find the objects of the given type and name in a snapshot. Returns the
+ * first one and sets |*pnum| to their number, or returns NULL.
+ */
+static X509_OBJECT *x509_store_snapshot_find(X509_STORE_SNAPSHOT *snap,
+                                             X509_LOOKUP_TYPE type,
+                                             X509_NAME *name, int *pnum)
+{
+    unsigned long hash;
+    const X509_STORE_RUN *run;
+    X509_OBJECT *obj;
+    int r;
+
+    if (type == X509_LU_NONE)
+        return NULL;
+    hash = x509_store_name_hash(type, name);
+    for (r = snap->buckets[hash & snap->mask]; r >= 0; r = run->next) {
+        run = &snap->runs[r];
+        obj = &snap->objs[run->first];
+        if (run->hash == hash && obj->type == type
+                && X509_NAME_cmp(x509_object_name(obj), name) == 0) {
+            *pnum = run->num;
+            return obj;
+        }
+    }
+    return NULL;
+}
+
 X509_STORE *X509_STORE_new(void)
 {
     X509_STORE *ret = OPENSSL_zalloc(sizeof(*ret));
@@ -223,6 +460,8 @@ void X509_STORE_free(X509_STORE *vfy)
     }
     sk_X509_LOOKUP_free(sk);
     sk_X509_OBJECT_pop_free(vfy->objs, X509_OBJECT_free);
+    x509_store_snapshot_free(vfy->snapshot);
+    x509_verify_cache_free(vfy->vcache);
 
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_X509_STORE, vfy, &vfy->ex_data);
     X509_VERIFY_PARAM_free(vfy->param);
@@ -286,13 +525,35 @@ X509_OBJECT *X509_STORE_CTX_get_obj_by_subject(X509_STORE_CTX *vs,
     return ret;
 }
 
+/*
+ * Find an object of the given type and name in |store| without taking a
+ * reference to it, for lookup methods that have just added it to the store.
+ * Objects are never removed from a store, so it remains valid.
+ */
+int x509_store_get0_by_subject(X509_STORE *store, X509_LOOKUP_TYPE type,
+                               X509_NAME *name, X509_OBJECT *ret)
+{
+    X509_STORE_SNAPSHOT *snap = x509_store_get1_snapshot(store);
+    X509_OBJECT *obj;
+    int cnt;
+
+    if (snap == NULL)
+        return 0;
+    obj = x509_store_snapshot_find(snap, type, name, &cnt);
+    if (obj != NULL)
+        *ret = *obj;
+    x509_store_snapshot_free(snap);
+    return obj != NULL;
+}
+
 int X509_STORE_CTX_get_by_subject(X509_STORE_CTX *vs, X509_LOOKUP_TYPE type,
                                   X509_NAME *name, X509_OBJECT *ret)
 {
     X509_STORE *store = vs->ctx;
+    X509_STORE_SNAPSHOT *snap;
     X509_LOOKUP *lu;
-    X509_OBJECT stmp, *tmp;
-    int i, j;
+    X509_OBJECT stmp, *tmp = NULL;
+    int i, j, cnt, ok;
 
     if (store == NULL)
         return 0;
@@ -300,10 +561,9 @@ int X509_STORE_CTX_get_by_subject(X509_STORE_CTX *vs, X509_LOOKUP_TYPE type,
     stmp.type = X509_LU_NONE;
     stmp.data.ptr = NULL;
 
-
-    X509_STORE_lock(store);
-    tmp = X509_OBJECT_retrieve_by_subject(store->objs, type, name);
-    X509_STORE_unlock(store);
+    if ((snap = x509_store_get1_snapshot(store)) == NULL)
+        return 0;
+    tmp = x509_store_snapshot_find(snap, type, name, &cnt);
 
     if (tmp == NULL || type == X509_LU_CRL) {
         for (i = 0; i < sk_X509_LOOKUP_num(store->get_cert_methods); i++) {
@@ -314,17 +574,15 @@ int X509_STORE_CTX_get_by_subject(X509_STORE_CTX *vs, X509_LOOKUP_TYPE type,
                 break;
             }
         }
-        if (tmp == NULL)
-            return 0;
     }
 
-    if (!X509_OBJECT_up_ref_count(tmp))
-        return 0;
-
-    ret->type = tmp->type;
-    ret->data.ptr = tmp->data.ptr;
-
-    return 1;
+    ok = tmp != NULL && X509_OBJECT_up_ref_count(tmp);
+    if (ok) {
+        ret->type = tmp->type;
+        ret->data.ptr = tmp->data.ptr;
+    }
+    x509_store_snapshot_free(snap);
+    return ok;
 }
 
 static int x509_store_add(X509_STORE *store, void *x, int crl) {
@@ -350,14 +608,16 @@ static int x509_store_add(X509_STORE *store, void *x, int crl) {
         return 0;
     }
 
-    X509_STORE_lock(store);
+    CRYPTO_THREAD_write_lock(store->lock);
     if (X509_OBJECT_retrieve_match(store->objs, obj)) {
         ret = 1;
     } else {
         added = sk_X509_OBJECT_push(store->objs, obj);
         ret = added != 0;
     }
-    X509_STORE_unlock(store);
+    if (added != 0)
+        x509_store_changed(store);
+    CRYPTO_THREAD_unlock(store->lock);
 
     if (added == 0)             /* obj not pushed */
         X509_OBJECT_free(obj);
@@ -532,27 +792,37 @@ STACK_OF(X509_OBJECT) *X509_STORE_get0_objects(X509_STORE *v)
     return v->objs;
 }
 
+unsigned long X509_STORE_get_generation(X509_STORE *v)
+{
+    unsigned long ret;
+
+    CRYPTO_THREAD_read_lock(v->lock);
+    ret = v->generation;
+    CRYPTO_THREAD_unlock(v->lock);
+    return ret;
+}
+
 STACK_OF(X509) *X509_STORE_CTX_get1_certs(X509_STORE_CTX *ctx, X509_NAME *nm)
 {
-    int i, idx, cnt;
+    int i, cnt;
     STACK_OF(X509) *sk = NULL;
     X509 *x;
     X509_OBJECT *obj;
     X509_STORE *store = ctx->ctx;
+    X509_STORE_SNAPSHOT *snap;
 
-    if (store == NULL)
+    if (store == NULL || (snap = x509_store_get1_snapshot(store)) == NULL)
         return NULL;
 
-    X509_STORE_lock(store);
-    idx = x509_object_idx_cnt(store->objs, X509_LU_X509, nm, &cnt);
-    if (idx < 0) {
+    obj = x509_store_snapshot_find(snap, X509_LU_X509, nm, &cnt);
+    if (obj == NULL) {
         /*
          * Nothing found in cache: do lookup to possibly add new objects to
          * cache
          */
         X509_OBJECT *xobj = X509_OBJECT_new();
 
-        X509_STORE_unlock(store);
+        x509_store_snapshot_free(snap);
 
         if (xobj == NULL)
             return NULL;
@@ -561,41 +831,42 @@ STACK_OF(X509) *X509_STORE_CTX_get1_certs(X509_STORE_CTX *ctx, X509_NAME *nm)
             return NULL;
         }
         X509_OBJECT_free(xobj);
-        X509_STORE_lock(store);
-        idx = x509_object_idx_cnt(store->objs, X509_LU_X509, nm, &cnt);
-        if (idx < 0) {
-            X509_STORE_unlock(store);
+        if ((snap = x509_store_get1_snapshot(store)) == NULL)
+            return NULL;
+        obj = x509_store_snapshot_find(snap, X509_LU_X509, nm, &cnt);
+        if (obj == NULL) {
+            x509_store_snapshot_free(snap);
             return NULL;
         }
     }
 
     sk = sk_X509_new_null();
-    for (i = 0; i < cnt; i++, idx++) {
-        obj = sk_X509_OBJECT_value(store->objs, idx);
+    for (i = 0; i < cnt; i++, obj++) {
         x = obj->data.x509;
         if (!X509_up_ref(x)) {
-            X509_STORE_unlock(store);
+            x509_store_snapshot_free(snap);
             sk_X509_pop_free(sk, X509_free);
             return NULL;
         }
         if (!sk_X509_push(sk, x)) {
-            X509_STORE_unlock(store);
+            x509_store_snapshot_free(snap);
             X509_free(x);
             sk_X509_pop_free(sk, X509_free);
             return NULL;
         }
     }
-    X509_STORE_unlock(store);
+    x509_store_snapshot_free(snap);
     return sk;
 }
 
 STACK_OF(X509_CRL) *X509_STORE_CTX_get1_crls(X509_STORE_CTX *ctx, X509_NAME *nm)
 {
-    int i, idx, cnt;
+    int i, cnt;
     STACK_OF(X509_CRL) *sk = sk_X509_CRL_new_null();
     X509_CRL *x;
     X509_OBJECT *obj, *xobj = X509_OBJECT_new();
     X509_STORE *store = ctx->ctx;
+    X509_STORE_SNAPSHOT *snap;
 
     /* Always do lookup to possibly add new CRLs to cache */
     if (sk == NULL
@@ -607,30 +878,32 @@ STACK_OF(X509_CRL) *X509_STORE_CTX_get1_crls(X509_STORE_CTX *ctx, X509_NAME *nm)
         return NULL;
     }
     X509_OBJECT_free(xobj);
-    X509_STORE_lock(store);
-    idx = x509_object_idx_cnt(store->objs, X509_LU_CRL, nm, &cnt);
-    if (idx < 0) {
-        X509_STORE_unlock(store);
+    if ((snap = x509_store_get1_snapshot(store)) == NULL) {
+        sk_X509_CRL_free(sk);
+        return NULL;
+    }
+    obj = x509_store_snapshot_find(snap, X509_LU_CRL, nm, &cnt);
+    if (obj == NULL) {
+        x509_store_snapshot_free(snap);
         sk_X509_CRL_free(sk);
         return NULL;
     }
 
-    for (i = 0; i < cnt; i++, idx++) {
-        obj = sk_X509_OBJECT_value(store->objs, idx);
+    for (i = 0; i < cnt; i++, obj++) {
         x = obj->data.crl;
         if (!X509_CRL_up_ref(x)) {
-            X509_STORE_unlock(store);
+            x509_store_snapshot_free(snap);
             sk_X509_CRL_pop_free(sk, X509_CRL_free);
             return NULL;
         }
         if (!sk_X509_CRL_push(sk, x)) {
-            X509_STORE_unlock(store);
+            x509_store_snapshot_free(snap);
             X509_CRL_free(x);
             sk_X509_CRL_pop_free(sk, X509_CRL_free);
             return NULL;
         }
     }
-    X509_STORE_unlock(store);
+    x509_store_snapshot_free(snap);
     return sk;
 }
 
@@ -679,7 +952,8 @@ int X509_STORE_CTX_get1_issuer(X509 **issuer, X509_STORE_CTX *ctx, X509 *x)
     X509_NAME *xn;
     X509_OBJECT *obj = X509_OBJECT_new(), *pobj = NULL;
     X509_STORE *store = ctx->ctx;
-    int i, ok, idx, ret;
+    X509_STORE_SNAPSHOT *snap;
+    int i, ok, cnt, ret;
 
     if (obj == NULL)
         return -1;
@@ -707,40 +981,32 @@ int X509_STORE_CTX_get1_issuer(X509 **issuer, X509_STORE_CTX *ctx, X509 *x)
     if (store == NULL)
         return 0;
 
-    /* Else find index of first cert accepted by 'check_issued' */
+    /* Else find first cert accepted by 'check_issued' */
+    if ((snap = x509_store_get1_snapshot(store)) == NULL)
+        return -1;
     ret = 0;
-    X509_STORE_lock(store);
-    idx = X509_OBJECT_idx_by_subject(store->objs, X509_LU_X509, xn);
-    if (idx != -1) {            /* should be true as we've had at least one
-                                 * match */
-        /* Look through all matching certs for suitable issuer */
-        for (i = idx; i < sk_X509_OBJECT_num(store->objs); i++) {
-            pobj = sk_X509_OBJECT_value(store->objs, i);
-            /* See if we've run past the matches */
-            if (pobj->type != X509_LU_X509)
-                break;
-            if (X509_NAME_cmp(xn, X509_get_subject_name(pobj->data.x509)))
+    pobj = x509_store_snapshot_find(snap, X509_LU_X509, xn, &cnt);
+    /* Look through all matching certs for suitable issuer */
+    for (i = 0; pobj != NULL && i < cnt; i++, pobj++) {
+        if (ctx->check_issued(ctx, x, pobj->data.x509)) {
+            *issuer = pobj->data.x509;
+            ret = 1;
+            /*
+             * If times check, exit with match,
+             * otherwise keep looking. Leave last
+             * match in issuer so we return nearest
+             * match if no certificate time is OK.
+             */
+
+            if (x509_check_cert_time(ctx, *issuer, -1))
                 break;
-            if (ctx->check_issued(ctx, x, pobj->data.x509)) {
-                *issuer = pobj->data.x509;
-                ret = 1;
-                /*
-                 * If times check, exit with match,
-                 * otherwise keep looking. Leave last
-                 * match in issuer so we return nearest
-                 * match if no certificate time is OK.
-                 */
-
-                if (x509_check_cert_time(ctx, *issuer, -1))
-                    break;
-            }
         }
     }
     if (*issuer && !X509_up_ref(*issuer)) {
         *issuer = NULL;
         ret = -1;
     }
-    X509_STORE_unlock(store);
+    x509_store_snapshot_free(snap);
     return ret;
 }
 
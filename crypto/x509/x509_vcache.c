@@ -0,0 +1,401 @@
+/*
+ * Copyright 2020 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include <string.h>
+#include "internal/cryptlib.h"
+#include <openssl/lhash.h>
+#include <openssl/sha.h>
+#include <openssl/x509.h>
+#include "crypto/x509.h"
+#include "x509_local.h"
+
+/*
+ * A cache of chains that X509_verify_cert() has already accepted. Servers
+ * that verify client certificates, and clients that talk to the same peers
+ * over and over, tend to see the same leaf and intermediates many times, and
+ * re-building and re-verifying the chain each time is mostly signature
+ * checks whose outcome is already known.
+ *
+ * Entries are keyed by a SHA-256 digest over the leaf, the untrusted
+ * certificates supplied by the caller and their trust settings, and every
+ * verification parameter that can change the outcome. Only successful
+ * results are kept, together with the time window in which every
+ * certificate in the chain, and every CRL consulted, is current. An entry
+ * is only used while the store's generation counter is unchanged, so adding
+ * or removing trusted objects invalidates everything cached before. The
+ * trust settings of a certificate can change without the store noticing,
+ * so each entry also records a digest of those of its chain, which is
+ * checked again before the chain is handed out.
+ */
+
+typedef struct x509_verify_cache_entry_st {
+    unsigned char key[SHA256_DIGEST_LENGTH];
+    unsigned char trust[SHA256_DIGEST_LENGTH];
+    STACK_OF(X509) *chain;
+    int num_untrusted;
+    ASN1_TIME *not_before;      /* latest notBefore in the chain */
+    ASN1_TIME *not_after;       /* earliest notAfter or CRL nextUpdate */
+    unsigned long generation;
+} X509_VCACHE_ENTRY;
+
+DEFINE_LHASH_OF(X509_VCACHE_ENTRY);
+
+struct x509_verify_cache_st {
+    LHASH_OF(X509_VCACHE_ENTRY) *entries;
+    /* Entries in insertion order, the oldest is replaced when full */
+    X509_VCACHE_ENTRY **ring;
+    size_t max;
+    size_t next;
+    CRYPTO_RWLOCK *lock;
+};
+
+static unsigned long vcache_entry_hash(const X509_VCACHE_ENTRY *e)
+{
+    return (unsigned long)e->key[0] | ((unsigned long)e->key[1] << 8)
+        | ((unsigned long)e->key[2] << 16) | ((unsigned long)e->key[3] << 24);
+}
+
+static int vcache_entry_cmp(const X509_VCACHE_ENTRY *a,
+                            const X509_VCACHE_ENTRY *b)
+{
+    return memcmp(a->key, b->key, sizeof(a->key));
+}
+
+static void vcache_entry_clear(X509_VCACHE_ENTRY *e)
+{
+    sk_X509_pop_free(e->chain, X509_free);
+    ASN1_TIME_free(e->not_before);
+    ASN1_TIME_free(e->not_after);
+    e->chain = NULL;
+    e->not_before = e->not_after = NULL;
+}
+
+static void vcache_entry_free(X509_VCACHE_ENTRY *e)
+{
+    if (e == NULL)
+        return;
+    vcache_entry_clear(e);
+    OPENSSL_free(e);
+}
+
+void x509_verify_cache_free(X509_VERIFY_CACHE *cache)
+{
+    size_t i;
+
+    if (cache == NULL)
+        return;
+    for (i = 0; i < cache->max; i++)
+        vcache_entry_free(cache->ring[i]);
+    OPENSSL_free(cache->ring);
+    lh_X509_VCACHE_ENTRY_free(cache->entries);
+    CRYPTO_THREAD_lock_free(cache->lock);
+    OPENSSL_free(cache);
+}
+
+int X509_STORE_set_verify_cache_size(X509_STORE *store, size_t num)
+{
+    X509_VERIFY_CACHE *cache = NULL, *old;
+
+    if (num > 0) {
+        if ((cache = OPENSSL_zalloc(sizeof(*cache))) == NULL
+                || (cache->ring = OPENSSL_zalloc(num * sizeof(*cache->ring)))
+                   == NULL
+                || (cache->entries = lh_X509_VCACHE_ENTRY_new(vcache_entry_hash,
+                                                              vcache_entry_cmp))
+                   == NULL
+                || (cache->lock = CRYPTO_THREAD_lock_new()) == NULL) {
+            x509_verify_cache_free(cache);
+            X509err(X509_F_X509_STORE_SET_VERIFY_CACHE_SIZE,
+                    ERR_R_MALLOC_FAILURE);
+            return 0;
+        }
+        cache->max = num;
+    }
+
+    if (!CRYPTO_THREAD_write_lock(store->lock)) {
+        x509_verify_cache_free(cache);
+        return 0;
+    }
+    old = store->vcache;
+    store->vcache = cache;
+    CRYPTO_THREAD_unlock(store->lock);
+
+    x509_verify_cache_free(old);
+    return 1;
+}
+
+static int vcache_digest_len(EVP_MD_CTX *mctx, size_t len)
+{
+    uint64_t n = len;
+
+    return EVP_DigestUpdate(mctx, &n, sizeof(n));
+}
+
+static int vcache_digest_str(EVP_MD_CTX *mctx, const void *data, size_t len)
+{
+    return vcache_digest_len(mctx, len)
+        && (len == 0 || EVP_DigestUpdate(mctx, data, len));
+}
+
+static int vcache_digest_objs(EVP_MD_CTX *mctx,
+                              const STACK_OF(ASN1_OBJECT) *objs)
+{
+    const ASN1_OBJECT *obj;
+    int i, n = sk_ASN1_OBJECT_num(objs);
+
+    if (!vcache_digest_len(mctx, n < 0 ? 0 : n))
+        return 0;
+    for (i = 0; i < n; i++) {
+        obj = sk_ASN1_OBJECT_value(objs, i);
+        if (!vcache_digest_str(mctx, OBJ_get0_data(obj), OBJ_length(obj)))
+            return 0;
+    }
+    return 1;
+}
+
+/* The trusted and rejected uses set on |x| with X509_add1_trust_object() */
+static int vcache_digest_trust(EVP_MD_CTX *mctx, const X509 *x)
+{
+    return vcache_digest_objs(mctx, x->aux != NULL ? x->aux->trust : NULL)
+        && vcache_digest_objs(mctx, x->aux != NULL ? x->aux->reject : NULL);
+}
+
+static int vcache_digest_cert(EVP_MD_CTX *mctx, X509 *x)
+{
+    unsigned char md[SHA256_DIGEST_LENGTH];
+    unsigned int len;
+
+    return X509_digest(x, EVP_sha256(), md, &len)
+        && EVP_DigestUpdate(mctx, md, len)
+        && vcache_digest_trust(mctx, x);
+}
+
+/* Digest the trust settings of every certificate in |chain| into |md| */
+static int vcache_chain_trust(STACK_OF(X509) *chain, unsigned char *md)
+{
+    EVP_MD_CTX *mctx = EVP_MD_CTX_new();
+    int i, ok = 0;
+
+    if (mctx == NULL || !EVP_DigestInit_ex(mctx, EVP_sha256(), NULL))
+        goto end;
+    for (i = 0; i < sk_X509_num(chain); i++)
+        if (!vcache_digest_trust(mctx, sk_X509_value(chain, i)))
+            goto end;
+    ok = EVP_DigestFinal_ex(mctx, md, NULL);
+ end:
+    EVP_MD_CTX_free(mctx);
+    return ok;
+}
+
+/* Compute the cache key for the verification |ctx| is about to perform */
+static int vcache_key(X509_STORE_CTX *ctx, unsigned char *key)
+{
+    X509_VERIFY_PARAM *vpm = ctx->param;
+    EVP_MD_CTX *mctx = EVP_MD_CTX_new();
+    int32_t ints[6];
+    uint64_t longs[2];
+    int i, n, ok = 0;
+
+    if (mctx == NULL || !EVP_DigestInit_ex(mctx, EVP_sha256(), NULL))
+        goto end;
+
+    if (!vcache_digest_cert(mctx, ctx->cert))
+        goto end;
+    n = sk_X509_num(ctx->untrusted);
+    if (!vcache_digest_len(mctx, n < 0 ? 0 : n))
+        goto end;
+    for (i = 0; i < n; i++)
+        if (!vcache_digest_cert(mctx, sk_X509_value(ctx->untrusted, i)))
+            goto end;
+
+    ints[0] = vpm->purpose;
+    ints[1] = vpm->trust;
+    ints[2] = vpm->depth;
+    ints[3] = vpm->auth_level;
+    ints[4] = vpm->hostflags;
+    ints[5] = (int32_t)vpm->inh_flags;
+    longs[0] = vpm->flags;
+    longs[1] = (vpm->flags & X509_V_FLAG_USE_CHECK_TIME) != 0
+               ? (uint64_t)vpm->check_time : 0;
+    if (!EVP_DigestUpdate(mctx, ints, sizeof(ints))
+            || !EVP_DigestUpdate(mctx, longs, sizeof(longs)))
+        goto end;
+
+    if (!vcache_digest_objs(mctx, vpm->policies))
+        goto end;
+    n = sk_OPENSSL_STRING_num(vpm->hosts);
+    if (!vcache_digest_len(mctx, n < 0 ? 0 : n))
+        goto end;
+    for (i = 0; i < n; i++) {
+        const char *host = sk_OPENSSL_STRING_value(vpm->hosts, i);
+
+        if (!vcache_digest_str(mctx, host, strlen(host)))
+            goto end;
+    }
+    if (!vcache_digest_str(mctx, vpm->email, vpm->emaillen)
+            || !vcache_digest_str(mctx, vpm->ip, vpm->iplen))
+        goto end;
+
+    ok = EVP_DigestFinal_ex(mctx, key, NULL);
+ end:
+    EVP_MD_CTX_free(mctx);
+    return ok;
+}
+
+/*
+ * Look up the verification |ctx| is about to perform. Fills in |key| and
+ * the store |generation| for a later x509_verify_cache_put(). Returns 1 and
+ * sets up |ctx->chain| on a hit, 0 on a miss and -1 if the result must not
+ * be cached.
+ */
+int x509_verify_cache_get(X509_STORE_CTX *ctx, unsigned char *key,
+                          unsigned long *generation)
+{
+    X509_STORE *store = ctx->ctx;
+    X509_VERIFY_CACHE *cache;
+    X509_VCACHE_ENTRY tmpl, *e;
+    unsigned char trust[SHA256_DIGEST_LENGTH];
+    time_t *ptime = NULL;
+    int ret = 0;
+
+    /* Compute the key without the lock, but only if there is a cache */
+    if (!CRYPTO_THREAD_read_lock(store->lock))
+        return -1;
+    cache = store->vcache;
+    CRYPTO_THREAD_unlock(store->lock);
+    if (cache == NULL || !vcache_key(ctx, key))
+        return -1;
+
+    /* Held throughout, so that the cache cannot be replaced underneath us */
+    if (!CRYPTO_THREAD_read_lock(store->lock))
+        return -1;
+    cache = store->vcache;
+    *generation = store->generation;
+    if (cache == NULL) {
+        CRYPTO_THREAD_unlock(store->lock);
+        return -1;
+    }
+
+    if (ctx->param->flags & X509_V_FLAG_USE_CHECK_TIME)
+        ptime = &ctx->param->check_time;
+
+    memcpy(tmpl.key, key, sizeof(tmpl.key));
+    CRYPTO_THREAD_read_lock(cache->lock);
+    e = lh_X509_VCACHE_ENTRY_retrieve(cache->entries, &tmpl);
+    if (e != NULL && e->generation == *generation
+            && ((ctx->param->flags & X509_V_FLAG_NO_CHECK_TIME) != 0
+                || ((e->not_before == NULL
+                     || X509_cmp_time(e->not_before, ptime) < 0)
+                    && (e->not_after == NULL
+                        || X509_cmp_time(e->not_after, ptime) > 0)))) {
+        ctx->chain = X509_chain_up_ref(e->chain);
+        ctx->num_untrusted = e->num_untrusted;
+        memcpy(trust, e->trust, sizeof(trust));
+        ret = ctx->chain != NULL;
+    }
+    CRYPTO_THREAD_unlock(cache->lock);
+    CRYPTO_THREAD_unlock(store->lock);
+
+    if (!ret)
+        return 0;
+
+    /* The leaf is the same certificate, but present the caller's object */
+    X509_free(sk_X509_value(ctx->chain, 0));
+    (void)sk_X509_set(ctx->chain, 0, ctx->cert);
+    X509_up_ref(ctx->cert);
+
+    /* Don't use the chain if the trust settings of any of it have changed */
+    if (!vcache_chain_trust(ctx->chain, tmpl.trust)
+            || memcmp(tmpl.trust, trust, sizeof(trust)) != 0) {
+        sk_X509_pop_free(ctx->chain, X509_free);
+        ctx->chain = NULL;
+        ctx->num_untrusted = 0;
+        return 0;
+    }
+    return 1;
+}
+
+/* Lower |*bound| to |t| if |t| is earlier, or raise it if |latest| is set */
+static int vcache_bound(ASN1_TIME **bound, const ASN1_TIME *t, int latest)
+{
+    int cmp;
+
+    if (t == NULL)
+        return 1;
+    if (*bound != NULL) {
+        cmp = ASN1_TIME_compare(t, *bound);
+        if (cmp == -2)
+            return 0;
+        if (latest ? cmp <= 0 : cmp >= 0)
+            return 1;
+        ASN1_TIME_free(*bound);
+    }
+    return (*bound = ASN1_STRING_dup(t)) != NULL;
+}
+
+/* Remember that the chain just built in |ctx| was successfully verified */
+void x509_verify_cache_put(X509_STORE_CTX *ctx, const unsigned char *key,
+                           unsigned long generation)
+{
+    X509_STORE *store = ctx->ctx;
+    X509_VERIFY_CACHE *cache;
+    X509_VCACHE_ENTRY *e, *old;
+    int i;
+
+    if ((e = OPENSSL_zalloc(sizeof(*e))) == NULL)
+        return;
+    memcpy(e->key, key, sizeof(e->key));
+    e->generation = generation;
+    e->num_untrusted = ctx->num_untrusted;
+    if ((e->chain = X509_chain_up_ref(ctx->chain)) == NULL
+            || !vcache_chain_trust(e->chain, e->trust)
+            || !vcache_bound(&e->not_after, ctx->crl_next_update, 0))
+        goto err;
+    for (i = 0; i < sk_X509_num(e->chain); i++) {
+        X509 *x = sk_X509_value(e->chain, i);
+
+        if (!vcache_bound(&e->not_before, X509_get0_notBefore(x), 1)
+                || !vcache_bound(&e->not_after, X509_get0_notAfter(x), 0))
+            goto err;
+    }
+
+    CRYPTO_THREAD_read_lock(store->lock);
+    cache = store->vcache;
+    if (cache == NULL || store->generation != generation) {
+        CRYPTO_THREAD_unlock(store->lock);
+        goto err;
+    }
+    CRYPTO_THREAD_write_lock(cache->lock);
+    if ((old = lh_X509_VCACHE_ENTRY_retrieve(cache->entries, e)) != NULL) {
+        /* Refresh the existing entry in place, keeping its ring slot */
+        vcache_entry_clear(old);
+        *old = *e;
+        OPENSSL_free(e);
+        e = NULL;
+    } else {
+        old = cache->ring[cache->next];
+        if (old != NULL)
+            (void)lh_X509_VCACHE_ENTRY_delete(cache->entries, old);
+        (void)lh_X509_VCACHE_ENTRY_insert(cache->entries, e);
+        if (lh_X509_VCACHE_ENTRY_error(cache->entries)) {
+            /* Put the evicted entry back, nothing has changed */
+            if (old != NULL)
+                (void)lh_X509_VCACHE_ENTRY_insert(cache->entries, old);
+        } else {
+            cache->ring[cache->next] = e;
+            cache->next = (cache->next + 1) % cache->max;
+            e = old;
+        }
+    }
+    CRYPTO_THREAD_unlock(cache->lock);
+    CRYPTO_THREAD_unlock(store->lock);
+
+ err:
+    vcache_entry_free(e);
+}
@@ -93,6 +93,9 @@ static void crl_akid_check(X509_STORE_CTX *ctx, X509_CRL *crl, X509 **pissuer,
 static int crl_crldp_check(X509 *x, X509_CRL *crl, int crl_score,
                            unsigned int *preasons);
 static int check_crl_path(X509_STORE_CTX *ctx, X509 *x);
+static int check_crl(X509_STORE_CTX *ctx, X509_CRL *crl);
+static int cert_crl(X509_STORE_CTX *ctx, X509_CRL *crl, X509 *x);
+static int note_crl_next_update(X509_STORE_CTX *ctx, X509_CRL *crl);
 static int check_crl_chain(X509_STORE_CTX *ctx,
                            STACK_OF(X509) *cert_path,
                            STACK_OF(X509) *crl_path);
@@ -250,9 +253,38 @@ static int verify_chain(X509_STORE_CTX *ctx)
     return ok;
 }
 
+/*
+ * The verified chain cache only remembers what the built-in logic decides.
+ * Anything that lets the application observe or override individual steps
+ * of the verification, or that depends on more than the store, the
+ * certificates and the parameters, rules it out.
+ */
+static int verify_cache_usable(X509_STORE_CTX *ctx)
+{
+    return ctx->ctx != NULL
+        && ctx->parent == NULL
+        && !DANETLS_ENABLED(ctx->dane)
+        && ctx->crls == NULL
+        && (ctx->param->flags & X509_V_FLAG_POLICY_CHECK) == 0
+        && ctx->verify == internal_verify
+        && ctx->verify_cb == null_callback
+        && ctx->get_issuer == X509_STORE_CTX_get1_issuer
+        && ctx->check_issued == check_issued
+        && ctx->check_revocation == check_revocation
+        && ctx->get_crl == NULL
+        && ctx->check_crl == check_crl
+        && ctx->cert_crl == cert_crl
+        && ctx->check_policy == check_policy
+        && ctx->lookup_certs == X509_STORE_CTX_get1_certs
+        && ctx->lookup_crls == X509_STORE_CTX_get1_crls;
+}
+
 int X509_verify_cert(X509_STORE_CTX *ctx)
 {
     SSL_DANE *dane = ctx->dane;
+    unsigned char key[EVP_MAX_MD_SIZE];
+    unsigned long generation = 0;
+    int cached = -1;
     int ret;
 
     if (ctx->cert == NULL) {
@@ -271,6 +303,19 @@ int X509_verify_cert(X509_STORE_CTX *ctx)
         return -1;
     }
 
+    if (verify_cache_usable(ctx)) {
+        cached = x509_verify_cache_get(ctx, key, &generation);
+        if (cached == 1) {
+            /* The identity checks also record the matched peername */
+            ctx->error = X509_V_OK;
+            ctx->error_depth = 0;
+            ctx->current_cert = ctx->cert;
+            if ((ret = check_id(ctx)) <= 0 && ctx->error == X509_V_OK)
+                ctx->error = X509_V_ERR_UNSPECIFIED;
+            return ret;
+        }
+    }
+
     /*
      * first we make sure the chain we are going to build is present and that
      * the first entry is in place
@@ -301,6 +346,8 @@ int X509_verify_cert(X509_STORE_CTX *ctx)
      */
     if (ret <= 0 && ctx->error == X509_V_OK)
         ctx->error = X509_V_ERR_UNSPECIFIED;
+    else if (ret > 0 && cached == 0 && ctx->error == X509_V_OK)
+        x509_verify_cache_put(ctx, key, generation);
     return ret;
 }
 
@@ -915,6 +962,13 @@ static int check_cert(X509_STORE_CTX *ctx)
                 goto done;
         }
 
+        if (!note_crl_next_update(ctx, crl)
+                || (dcrl != NULL && !note_crl_next_update(ctx, dcrl))) {
+            ctx->error = X509_V_ERR_OUT_OF_MEM;
+            ok = 0;
+            goto done;
+        }
+
         X509_CRL_free(crl);
         X509_CRL_free(dcrl);
         crl = NULL;
@@ -936,6 +990,21 @@ static int check_cert(X509_STORE_CTX *ctx)
     return ok;
 }
 
+/*
+ * Keep track of the earliest nextUpdate of the CRLs a chain was checked
+ * against, the result cannot be reused past that time.
+ */
+static int note_crl_next_update(X509_STORE_CTX *ctx, X509_CRL *crl)
+{
+    const ASN1_TIME *next = X509_CRL_get0_nextUpdate(crl);
+
+    if (next == NULL || (ctx->crl_next_update != NULL
+                         && ASN1_TIME_compare(next, ctx->crl_next_update) >= 0))
+        return 1;
+    ASN1_TIME_free(ctx->crl_next_update);
+    return (ctx->crl_next_update = ASN1_STRING_dup(next)) != NULL;
+}
+
 /* Check CRL times against values in X509_STORE_CTX */
 
 static int check_crl_time(X509_STORE_CTX *ctx, X509_CRL *crl, int notify)
@@ -2225,6 +2294,7 @@ int X509_STORE_CTX_init(X509_STORE_CTX *ctx, X509_STORE *store, X509 *x509,
     ctx->parent = NULL;
     ctx->dane = NULL;
     ctx->bare_ta_signed = 0;
+    ctx->crl_next_update = NULL;
     /* Zero ex_data to make sure we're cleanup-safe */
     memset(&ctx->ex_data, 0, sizeof(ctx->ex_data));
 
@@ -2371,6 +2441,8 @@ void X509_STORE_CTX_cleanup(X509_STORE_CTX *ctx)
     ctx->tree = NULL;
     sk_X509_pop_free(ctx->chain, X509_free);
     ctx->chain = NULL;
+    ASN1_TIME_free(ctx->crl_next_update);
+    ctx->crl_next_update = NULL;
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_X509_STORE_CTX, ctx, &(ctx->ex_data));
     memset(&ctx->ex_data, 0, sizeof(ctx->ex_data));
 }
@@ -15,6 +15,7 @@
 #include <openssl/evp.h>
 #include <openssl/x509.h>
 #include "crypto/x509.h"
+#include "x509_local.h"
 
 int X509_CRL_set_version(X509_CRL *x, long version)
 {
@@ -60,6 +61,7 @@ int X509_CRL_sort(X509_CRL *c)
         r = sk_X509_REVOKED_value(c->crl.revoked, i);
         r->sequence = i;
     }
+    x509_crl_drop_serial_index(c);
     c->crl.enc.modified = 1;
     return 1;
 }
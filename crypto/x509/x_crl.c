@@ -8,7 +8,7 @@
  */
 
 #include <stdio.h>
-#include "internal/cryptlib.h"
+#include "crypto/cryptlib.h"
 #include <openssl/asn1t.h>
 #include <openssl/x509.h>
 #include "crypto/x509.h"
@@ -168,6 +168,7 @@ static int crl_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
         ASN1_INTEGER_free(crl->crl_number);
         ASN1_INTEGER_free(crl->base_crl_number);
         sk_GENERAL_NAMES_pop_free(crl->issuers, GENERAL_NAMES_free);
+        x509_crl_drop_serial_index(crl);
         /* fall thru */
 
     case ASN1_OP_NEW_POST:
@@ -181,6 +182,7 @@ static int crl_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
         crl->issuers = NULL;
         crl->crl_number = NULL;
         crl->base_crl_number = NULL;
+        crl->serial_index = NULL;
         break;
 
     case ASN1_OP_D2I_POST:
@@ -252,6 +254,7 @@ static int crl_cb(int operation, ASN1_VALUE **pval, const ASN1_ITEM *it,
         ASN1_INTEGER_free(crl->crl_number);
         ASN1_INTEGER_free(crl->base_crl_number);
         sk_GENERAL_NAMES_pop_free(crl->issuers, GENERAL_NAMES_free);
+        x509_crl_drop_serial_index(crl);
         break;
     }
     return 1;
@@ -329,6 +332,7 @@ int X509_CRL_add0_revoked(X509_CRL *crl, X509_REVOKED *rev)
         ASN1err(ASN1_F_X509_CRL_ADD0_REVOKED, ERR_R_MALLOC_FAILURE);
         return 0;
     }
+    x509_crl_drop_serial_index(crl);
     inf->enc.modified = 1;
     return 1;
 }
@@ -390,41 +394,158 @@ static int crl_revoked_issuer_match(X509_CRL *crl, X509_NAME *nm,
 
 }
 
+/*
+ * Revoked entries are looked up through a hash index over their serial
+ * numbers: an open addressing table of positions in |crl.revoked|, kept in a
+ * single allocation. It is built on the first lookup, and unlike sorting the
+ * entries in place it leaves their order alone and costs one pass over them.
+ */
+typedef struct {
+    uint32_t hash;
+    uint32_t pos;               /* position + 1, zero marks an empty slot */
+} CRL_SERIAL_SLOT;
+
+struct x509_crl_serial_index_st {
+    /* The stack that was indexed, and its ossl_sk_changes() at the time */
+    const STACK_OF(X509_REVOKED) *revoked;
+    unsigned int changes;
+    size_t mask;
+    CRL_SERIAL_SLOT *slots;
+};
+
+static uint32_t crl_serial_hash(const ASN1_INTEGER *serial)
+{
+    uint32_t h = 2166136261U;
+    int i;
+
+    if (serial->type == V_ASN1_NEG_INTEGER)
+        h = (h ^ 0xff) * 16777619U;
+    for (i = 0; i < serial->length; i++)
+        h = (h ^ serial->data[i]) * 16777619U;
+    return h;
+}
+
+static X509_CRL_SERIAL_INDEX *crl_serial_index_new(
+    const STACK_OF(X509_REVOKED) *revoked)
+{
+    X509_CRL_SERIAL_INDEX *index;
+    int i, num = sk_X509_REVOKED_num(revoked);
+    size_t size = 16, j;
+
+    /* Keep the table at most half full */
+    while (size < (size_t)num * 2)
+        size <<= 1;
+    index = OPENSSL_zalloc(sizeof(*index) + size * sizeof(CRL_SERIAL_SLOT));
+    if (index == NULL)
+        return NULL;
+    index->revoked = revoked;
+    index->changes = ossl_sk_changes((const OPENSSL_STACK *)revoked);
+    index->mask = size - 1;
+    index->slots = (CRL_SERIAL_SLOT *)(index + 1);
+
+    for (i = 0; i < num; i++) {
+        const X509_REVOKED *rev = sk_X509_REVOKED_value(revoked, i);
+        uint32_t h = crl_serial_hash(&rev->serialNumber);
+
+        for (j = h & index->mask; index->slots[j].pos != 0;
+             j = (j + 1) & index->mask)
+            continue;
+        index->slots[j].hash = h;
+        index->slots[j].pos = (uint32_t)i + 1;
+    }
+    return index;
+}
+
+void x509_crl_drop_serial_index(X509_CRL *crl)
+{
+    OPENSSL_free(crl->serial_index);
+    crl->serial_index = NULL;
+}
+
+static int crl_serial_index_current(const X509_CRL *crl,
+                                    const X509_CRL_SERIAL_INDEX *index)
+{
+    return index != NULL && index->revoked == crl->crl.revoked
+        && index->changes
+           == ossl_sk_changes((const OPENSSL_STACK *)crl->crl.revoked);
+}
+
+/*
+ * Return the serial index of |crl|, building it if needed. The index is also
+ * rebuilt if the entries were changed in any way through
+ * X509_CRL_get_REVOKED(). NULL is only returned when memory is short.
+ */
+static const X509_CRL_SERIAL_INDEX *crl_get0_serial_index(X509_CRL *crl)
+{
+    X509_CRL_SERIAL_INDEX *index;
+
+    CRYPTO_THREAD_read_lock(crl->lock);
+    index = crl->serial_index;
+    CRYPTO_THREAD_unlock(crl->lock);
+    if (crl_serial_index_current(crl, index))
+        return index;
+
+    CRYPTO_THREAD_write_lock(crl->lock);
+    if (!crl_serial_index_current(crl, crl->serial_index)) {
+        x509_crl_drop_serial_index(crl);
+        crl->serial_index = crl_serial_index_new(crl->crl.revoked);
+    }
+    index = crl->serial_index;
+    CRYPTO_THREAD_unlock(crl->lock);
+    return index;
+}
+
+static int crl_revoked_match(X509_CRL *crl, X509_REVOKED *rev,
+                             ASN1_INTEGER *serial, X509_NAME *issuer,
+                             X509_REVOKED **ret)
+{
+    if (ASN1_INTEGER_cmp(&rev->serialNumber, serial) != 0
+            || !crl_revoked_issuer_match(crl, issuer, rev))
+        return 0;
+    if (ret)
+        *ret = rev;
+    if (rev->reason == CRL_REASON_REMOVE_FROM_CRL)
+        return 2;
+    return 1;
+}
+
 static int def_crl_lookup(X509_CRL *crl,
                           X509_REVOKED **ret, ASN1_INTEGER *serial,
                           X509_NAME *issuer)
 {
-    X509_REVOKED rtmp, *rev;
-    int idx, num;
+    const X509_CRL_SERIAL_INDEX *index;
+    uint32_t h;
+    size_t i;
+    int idx, num, rv;
 
     if (crl->crl.revoked == NULL)
         return 0;
 
-    /*
-     * Sort revoked into serial number order if not already sorted. Do this
-     * under a lock to avoid race condition.
-     */
-    if (!sk_X509_REVOKED_is_sorted(crl->crl.revoked)) {
-        CRYPTO_THREAD_write_lock(crl->lock);
-        sk_X509_REVOKED_sort(crl->crl.revoked);
-        CRYPTO_THREAD_unlock(crl->lock);
-    }
-    rtmp.serialNumber = *serial;
-    idx = sk_X509_REVOKED_find(crl->crl.revoked, &rtmp);
-    if (idx < 0)
-        return 0;
-    /* Need to look for matching name */
-    for (num = sk_X509_REVOKED_num(crl->crl.revoked); idx < num; idx++) {
-        rev = sk_X509_REVOKED_value(crl->crl.revoked, idx);
-        if (ASN1_INTEGER_cmp(&rev->serialNumber, serial))
-            return 0;
-        if (crl_revoked_issuer_match(crl, issuer, rev)) {
-            if (ret)
-                *ret = rev;
-            if (rev->reason == CRL_REASON_REMOVE_FROM_CRL)
-                return 2;
-            return 1;
+    if ((index = crl_get0_serial_index(crl)) == NULL) {
+        /* Without an index all we can do is look at every entry */
+        num = sk_X509_REVOKED_num(crl->crl.revoked);
+        for (idx = 0; idx < num; idx++) {
+            rv = crl_revoked_match(crl,
+                                   sk_X509_REVOKED_value(crl->crl.revoked, idx),
+                                   serial, issuer, ret);
+            if (rv != 0)
+                return rv;
         }
+        return 0;
+    }
+
+    /* There can be entries for the same serial number from several issuers */
+    h = crl_serial_hash(serial);
+    for (i = h & index->mask; index->slots[i].pos != 0;
+         i = (i + 1) & index->mask) {
+        if (index->slots[i].hash != h)
+            continue;
+        rv = crl_revoked_match(crl,
+                               sk_X509_REVOKED_value(crl->crl.revoked,
+                                                     index->slots[i].pos - 1),
+                               serial, issuer, ret);
+        if (rv != 0)
+            return rv;
     }
     return 0;
 }
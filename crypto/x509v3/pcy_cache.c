@@ -169,6 +169,8 @@ static int policy_cache_new(X509 *x)
     x->ex_flags |= EXFLAG_INVALID_POLICY;
 
  just_cleanup:
+    /* The cache is shared by all users of |x|, so finds must not sort it */
+    sk_X509_POLICY_DATA_freeze(cache->data);
     POLICY_CONSTRAINTS_free(ext_pcons);
     ASN1_INTEGER_free(ext_any);
     return 1;
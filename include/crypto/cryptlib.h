@@ -33,3 +33,6 @@ int ossl_init_thread_start(uint64_t opts);
 # define OPENSSL_INIT_THREAD_RAND            0x04
 
 void ossl_malloc_setup_failures(void);
+
+/* Changes whenever the contents or the order of |st| change */
+unsigned int ossl_sk_changes(const OPENSSL_STACK *st);
@@ -84,6 +84,8 @@ struct X509_crl_info_st {
     ASN1_ENCODING enc;                      /* encoding of signed portion of CRL */
 };
 
+typedef struct x509_crl_serial_index_st X509_CRL_SERIAL_INDEX;
+
 struct X509_crl_st {
     X509_CRL_INFO crl;          /* signed CRL data */
     X509_ALGOR sig_alg;         /* CRL signature algorithm */
@@ -108,6 +110,8 @@ struct X509_crl_st {
     /* alternative method to handle this CRL */
     const X509_CRL_METHOD *meth;
     void *meth_data;
+    /* Hash index of the revoked entries, built on the first lookup */
+    X509_CRL_SERIAL_INDEX *serial_index;
     CRYPTO_RWLOCK *lock;
 };
 
@@ -253,6 +257,8 @@ struct x509_store_ctx_st {      /* X509_STORE_CTX */
     SSL_DANE *dane;
     /* signed via bare TA public key, rather than CA certificate */
     int bare_ta_signed;
+    /* Earliest nextUpdate of the CRLs checked, bounds caching the result */
+    ASN1_TIME *crl_next_update;
 };
 
 /* PKCS#8 private key info structure */
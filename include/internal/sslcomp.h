@@ -0,0 +1,22 @@
+/*
+ * Copyright 2020 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#ifndef OSSL_INTERNAL_SSLCOMP_H
+# define OSSL_INTERNAL_SSLCOMP_H
+
+# include <openssl/opensslconf.h>
+
+# ifndef OPENSSL_NO_COMP
+#  include <openssl/comp.h>
+
+/* zlib without state kept between blocks, for certificate compression */
+COMP_METHOD *COMP_zlib_oneshot(void);
+# endif
+
+#endif
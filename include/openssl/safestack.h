@@ -109,6 +109,14 @@ extern "C" {
     { \
         return OPENSSL_sk_is_sorted((const OPENSSL_STACK *)sk); \
     } \
+    static ossl_unused ossl_inline int sk_##t1##_freeze(STACK_OF(t1) *sk) \
+    { \
+        return OPENSSL_sk_freeze((OPENSSL_STACK *)sk); \
+    } \
+    static ossl_unused ossl_inline int sk_##t1##_is_frozen(const STACK_OF(t1) *sk) \
+    { \
+        return OPENSSL_sk_is_frozen((const OPENSSL_STACK *)sk); \
+    } \
     static ossl_unused ossl_inline STACK_OF(t1) * sk_##t1##_dup(const STACK_OF(t1) *sk) \
     { \
         return (STACK_OF(t1) *)OPENSSL_sk_dup((const OPENSSL_STACK *)sk); \
@@ -196,6 +204,8 @@ DEFINE_SPECIAL_STACK_OF(OPENSSL_BLOCK, void)
 #  pragma weak OPENSSL_sk_find_ex
 #  pragma weak OPENSSL_sk_sort
 #  pragma weak OPENSSL_sk_is_sorted
+#  pragma weak OPENSSL_sk_freeze
+#  pragma weak OPENSSL_sk_is_frozen
 #  pragma weak OPENSSL_sk_dup
 #  pragma weak OPENSSL_sk_deep_copy
 #  pragma weak OPENSSL_sk_set_cmp_func
@@ -27,6 +27,9 @@
 # include <openssl/async.h>
 
 # include <openssl/safestack.h>
+# ifndef OPENSSL_NO_KTLS
+#  include <sys/types.h>
+# endif
 # include <openssl/symhacks.h>
 # include <openssl/ct.h>
 # include <openssl/sslerr.h>
@@ -52,6 +55,9 @@ extern "C" {
 /* The maximum number of encrypt/decrypt pipelines we can support */
 # define SSL_MAX_PIPELINES  32
 
+/* The deepest pool of ephemeral keys SSL_CTX_set_ephemeral_key_pool() allows */
+# define SSL_MAX_EPHEMERAL_KEY_POOL  1024
+
 /* text strings for the ciphers */
 
 /* These are used to specify which ciphers to use and not to use */
@@ -302,8 +308,8 @@ typedef int (*SSL_verify_cb)(int preverify_ok, X509_STORE_CTX *x509_ctx);
  */
 /* Allow initial connection to servers that don't support RI */
 # define SSL_OP_LEGACY_SERVER_CONNECT                    0x00000004U
-
-/* Reserved value (until OpenSSL 1.2.0)                  0x00000008U */
+/* Enable support for Kernel TLS */
+# define SSL_OP_ENABLE_KTLS                              0x00000008U
 # define SSL_OP_TLSEXT_PADDING                           0x00000010U
 /* Reserved value (until OpenSSL 1.2.0)                  0x00000020U */
 # define SSL_OP_SAFARI_ECDHE_ECDSA_BUG                   0x00000040U
@@ -507,6 +513,13 @@ typedef int (*SSL_verify_cb)(int preverify_ok, X509_STORE_CTX *x509_ctx);
  */
 # define SSL_MODE_DTLS_SCTP_LABEL_LENGTH_BUG 0x00000400U
 
+/*
+ * Decrypt TLSv1.3 application data records straight into the buffer passed
+ * to SSL_read() when it can take the whole record, instead of decrypting in
+ * the read buffer and copying the plaintext out.
+ */
+# define SSL_MODE_DECRYPT_TO_USER_BUFFER 0x00000800U
+
 /* Cert related flags */
 /*
  * Many implementations ignore some aspects of the TLS standards such as
@@ -679,6 +692,7 @@ typedef int (*GEN_SESSION_CB) (SSL *ssl, unsigned char *id,
 # define SSL_SESS_CACHE_NO_INTERNAL_STORE        0x0200
 # define SSL_SESS_CACHE_NO_INTERNAL \
         (SSL_SESS_CACHE_NO_INTERNAL_LOOKUP|SSL_SESS_CACHE_NO_INTERNAL_STORE)
+# define SSL_SESS_CACHE_SHARDED                  0x0800
 
 LHASH_OF(SSL_SESSION) *SSL_CTX_sessions(SSL_CTX *ctx);
 # define SSL_CTX_sess_number(ctx) \
@@ -706,6 +720,17 @@ LHASH_OF(SSL_SESSION) *SSL_CTX_sessions(SSL_CTX *ctx);
 # define SSL_CTX_sess_cache_full(ctx) \
         SSL_CTX_ctrl(ctx,SSL_CTRL_SESS_CACHE_FULL,0,NULL)
 
+# define SSL_CTX_set_buffer_pool_size(ctx,n) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_SET_BUFFER_POOL_SIZE,n,NULL)
+# define SSL_CTX_get_buffer_pool_size(ctx) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_GET_BUFFER_POOL_SIZE,0,NULL)
+# define SSL_CTX_buffer_pool_hits(ctx) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_BUFFER_POOL_HITS,0,NULL)
+# define SSL_CTX_buffer_pool_misses(ctx) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_BUFFER_POOL_MISSES,0,NULL)
+# define SSL_CTX_buffer_pool_bytes(ctx) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_BUFFER_POOL_BYTES,0,NULL)
+
 void SSL_CTX_sess_set_new_cb(SSL_CTX *ctx,
                              int (*new_session_cb) (struct ssl_st *ssl,
                                                     SSL_SESSION *sess));
@@ -726,6 +751,8 @@ void SSL_CTX_sess_set_get_cb(SSL_CTX *ctx,
 SSL_SESSION *(*SSL_CTX_sess_get_get_cb(SSL_CTX *ctx)) (struct ssl_st *ssl,
                                                        const unsigned char *data,
                                                        int len, int *copy);
+__owur int SSL_CTX_set_shared_session_cache(SSL_CTX *ctx, size_t num_sessions,
+                                            size_t max_session_len);
 void SSL_CTX_set_info_callback(SSL_CTX *ctx,
                                void (*cb) (const SSL *ssl, int type, int val));
 void (*SSL_CTX_get_info_callback(SSL_CTX *ctx)) (const SSL *ssl, int type,
@@ -813,6 +840,16 @@ void SSL_CTX_set_alpn_select_cb(SSL_CTX *ctx,
 void SSL_get0_alpn_selected(const SSL *ssl, const unsigned char **data,
                             unsigned int *len);
 
+typedef int (*SSL_cert_compress_cb_fn)(SSL *s,
+                                       const unsigned char *in, size_t inlen,
+                                       unsigned char *out, size_t *outlen);
+typedef int (*SSL_cert_decompress_cb_fn)(SSL *s,
+                                         const unsigned char *in, size_t inlen,
+                                         unsigned char *out, size_t outlen);
+__owur int SSL_CTX_add_cert_compression_alg(SSL_CTX *ctx, int alg,
+                                            SSL_cert_compress_cb_fn compress,
+                                            SSL_cert_decompress_cb_fn decompress);
+
 # ifndef OPENSSL_NO_PSK
 /*
  * the maximum length of the buffer given to callbacks containing the
@@ -1305,6 +1342,16 @@ DECLARE_PEM_rw(SSL_SESSION, SSL_SESSION)
 # define SSL_CTRL_GET_MAX_PROTO_VERSION          131
 # define SSL_CTRL_GET_SIGNATURE_NID              132
 # define SSL_CTRL_GET_TMP_KEY                    133
+# define SSL_CTRL_SET_TLSEXT_TICKET_KEY_HISTORY  134
+# define SSL_CTRL_GET_TLSEXT_TICKET_KEY_HISTORY  135
+# define SSL_CTRL_ROTATE_TLSEXT_TICKET_KEYS      136
+# define SSL_CTRL_SET_BUFFER_POOL_SIZE           137
+# define SSL_CTRL_GET_BUFFER_POOL_SIZE           138
+# define SSL_CTRL_BUFFER_POOL_HITS               139
+# define SSL_CTRL_BUFFER_POOL_MISSES             140
+# define SSL_CTRL_BUFFER_POOL_BYTES              141
+# define SSL_CTRL_GET_DYNAMIC_RECORD_SMALL       142
+# define SSL_CTRL_GET_DYNAMIC_RECORD_RESETS      143
 # define SSL_CERT_SET_FIRST                      1
 # define SSL_CERT_SET_NEXT                       2
 # define SSL_CERT_SET_SERVER                     3
@@ -1839,6 +1886,21 @@ __owur int SSL_peek(SSL *ssl, void *buf, int num);
 __owur int SSL_peek_ex(SSL *ssl, void *buf, size_t num, size_t *readbytes);
 __owur int SSL_write(SSL *ssl, const void *buf, int num);
 __owur int SSL_write_ex(SSL *s, const void *buf, size_t num, size_t *written);
+
+/* A buffer for SSL_writev() and SSL_readv(), laid out like struct iovec */
+typedef struct ssl_iovec_st {
+    void *iov_base;
+    size_t iov_len;
+} SSL_IOVEC;
+
+__owur int SSL_writev(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                      size_t *written);
+__owur int SSL_readv(SSL *s, const SSL_IOVEC *iov, size_t iovcnt,
+                     size_t *readbytes);
+# ifndef OPENSSL_NO_KTLS
+__owur ossl_ssize_t SSL_sendfile(SSL *s, int fd, off_t offset, size_t size,
+                                 int flags);
+# endif
 __owur int SSL_write_early_data(SSL *s, const void *buf, size_t num,
                                 size_t *written);
 long SSL_ctrl(SSL *ssl, int cmd, long larg, void *parg);
@@ -2061,6 +2123,15 @@ __owur int SSL_get_ex_data_X509_STORE_CTX_idx(void);
         SSL_CTX_ctrl(ctx,SSL_CTRL_SET_MAX_PIPELINES,m,NULL)
 # define SSL_set_max_pipelines(ssl,m) \
         SSL_ctrl(ssl,SSL_CTRL_SET_MAX_PIPELINES,m,NULL)
+# define SSL_get_dynamic_record_small(ssl) \
+        SSL_ctrl(ssl,SSL_CTRL_GET_DYNAMIC_RECORD_SMALL,0,NULL)
+# define SSL_get_dynamic_record_resets(ssl) \
+        SSL_ctrl(ssl,SSL_CTRL_GET_DYNAMIC_RECORD_RESETS,0,NULL)
+
+int SSL_CTX_set_dynamic_record_size(SSL_CTX *ctx, size_t initial_size,
+                                    size_t ramp_bytes, long idle_timeout);
+int SSL_set_dynamic_record_size(SSL *s, size_t initial_size,
+                                size_t ramp_bytes, long idle_timeout);
 
 void SSL_CTX_set_default_read_buffer_len(SSL_CTX *ctx, size_t len);
 void SSL_set_default_read_buffer_len(SSL *s, size_t len);
@@ -2135,6 +2206,10 @@ size_t SSL_get_num_tickets(const SSL *s);
 int SSL_CTX_set_num_tickets(SSL_CTX *ctx, size_t num_tickets);
 size_t SSL_CTX_get_num_tickets(const SSL_CTX *ctx);
 
+int SSL_CTX_set_ephemeral_key_pool(SSL_CTX *ctx, size_t depth);
+size_t SSL_CTX_get_ephemeral_key_pool(const SSL_CTX *ctx);
+int SSL_CTX_fill_ephemeral_key_pool(SSL_CTX *ctx, int nid);
+
 # if OPENSSL_API_COMPAT < 0x10100000L
 #  define SSL_cache_hit(s) SSL_session_reused(s)
 # endif
@@ -49,6 +49,8 @@ OPENSSL_sk_compfunc OPENSSL_sk_set_cmp_func(OPENSSL_STACK *sk,
 OPENSSL_STACK *OPENSSL_sk_dup(const OPENSSL_STACK *st);
 void OPENSSL_sk_sort(OPENSSL_STACK *st);
 int OPENSSL_sk_is_sorted(const OPENSSL_STACK *st);
+int OPENSSL_sk_freeze(OPENSSL_STACK *st);
+int OPENSSL_sk_is_frozen(const OPENSSL_STACK *st);
 
 # if OPENSSL_API_COMPAT < 0x10100000L
 #  define _STACK OPENSSL_STACK
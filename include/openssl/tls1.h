@@ -131,6 +131,9 @@ extern "C" {
 /* ExtensionType value from RFC7627 */
 # define TLSEXT_TYPE_extended_master_secret      23
 
+/* ExtensionType value from RFC8879 */
+# define TLSEXT_TYPE_compress_certificate        27
+
 /* ExtensionType value from RFC4507 */
 # define TLSEXT_TYPE_session_ticket              35
 
@@ -145,6 +148,11 @@ extern "C" {
 # define TLSEXT_TYPE_signature_algorithms_cert   50
 # define TLSEXT_TYPE_key_share                   51
 
+/* CertificateCompressionAlgorithm values from RFC8879 */
+# define TLSEXT_comp_cert_zlib                   1
+# define TLSEXT_comp_cert_brotli                 2
+# define TLSEXT_comp_cert_zstd                   3
+
 /* Temporary extension type */
 # define TLSEXT_TYPE_renegotiate                 0xff01
 
@@ -304,6 +312,12 @@ __owur int SSL_check_chain(SSL *s, X509 *x, EVP_PKEY *pk, STACK_OF(X509) *chain)
         SSL_CTX_ctrl(ctx,SSL_CTRL_GET_TLSEXT_TICKET_KEYS,keylen,keys)
 # define SSL_CTX_set_tlsext_ticket_keys(ctx, keys, keylen) \
         SSL_CTX_ctrl(ctx,SSL_CTRL_SET_TLSEXT_TICKET_KEYS,keylen,keys)
+# define SSL_CTX_rotate_tlsext_ticket_keys(ctx) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_ROTATE_TLSEXT_TICKET_KEYS,0,NULL)
+# define SSL_CTX_set_tlsext_ticket_key_history(ctx, num) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_SET_TLSEXT_TICKET_KEY_HISTORY,num,NULL)
+# define SSL_CTX_get_tlsext_ticket_key_history(ctx) \
+        SSL_CTX_ctrl(ctx,SSL_CTRL_GET_TLSEXT_TICKET_KEY_HISTORY,0,NULL)
 
 # define SSL_CTX_get_tlsext_status_cb(ssl, cb) \
         SSL_CTX_ctrl(ssl,SSL_CTRL_GET_TLSEXT_STATUS_REQ_CB,0,(void *)cb)
@@ -0,0 +1,168 @@
+/*
+ * Copyright 2018-2020 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+#include "ssl_local.h"
+
+#ifndef OPENSSL_NO_KTLS
+# include "internal/bio.h"
+# include "internal/ktls.h"
+
+/*
+ * The AES-GCM structures only differ in the key size. In TLSv1.2 |iv| is the
+ * 4 byte implicit part of the nonce and the 8 byte explicit part is taken
+ * from the record sequence number; in TLSv1.3 |iv| is the full 12 byte static
+ * IV which the kernel splits into salt and IV.
+ */
+static int ktls_fill_gcm(unsigned char *ciphkey, size_t ciphkeylen,
+                         unsigned char *ciphsalt, unsigned char *ciphiv,
+                         unsigned char *ciphseq,
+                         const unsigned char *key, size_t keylen,
+                         const unsigned char *iv, size_t ivlen,
+                         const unsigned char *rl_sequence)
+{
+    if (keylen != ciphkeylen)
+        return 0;
+
+    memcpy(ciphkey, key, keylen);
+    memcpy(ciphsalt, iv, EVP_GCM_TLS_FIXED_IV_LEN);
+    if (ivlen == EVP_GCM_TLS_FIXED_IV_LEN)
+        memcpy(ciphiv, rl_sequence, EVP_GCM_TLS_EXPLICIT_IV_LEN);
+    else if (ivlen == EVP_GCM_TLS_FIXED_IV_LEN + EVP_GCM_TLS_EXPLICIT_IV_LEN)
+        memcpy(ciphiv, iv + EVP_GCM_TLS_FIXED_IV_LEN,
+               EVP_GCM_TLS_EXPLICIT_IV_LEN);
+    else
+        return 0;
+    memcpy(ciphseq, rl_sequence, SEQ_NUM_SIZE);
+    return 1;
+}
+
+static int ktls_configure_crypto(const SSL *s, const EVP_CIPHER *c,
+                                 ktls_crypto_info_t *crypto_info,
+                                 const unsigned char *rl_sequence,
+                                 const unsigned char *key, size_t keylen,
+                                 const unsigned char *iv, size_t ivlen)
+{
+    memset(crypto_info, 0, sizeof(*crypto_info));
+
+    switch (EVP_CIPHER_nid(c)) {
+    case NID_aes_128_gcm:
+        crypto_info->u.gcm128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+        crypto_info->u.gcm128.info.version = s->version;
+        crypto_info->tls_len = sizeof(crypto_info->u.gcm128);
+        return ktls_fill_gcm(crypto_info->u.gcm128.key,
+                             sizeof(crypto_info->u.gcm128.key),
+                             crypto_info->u.gcm128.salt,
+                             crypto_info->u.gcm128.iv,
+                             crypto_info->u.gcm128.rec_seq,
+                             key, keylen, iv, ivlen, rl_sequence);
+# ifdef TLS_CIPHER_AES_GCM_256
+    case NID_aes_256_gcm:
+        crypto_info->u.gcm256.info.cipher_type = TLS_CIPHER_AES_GCM_256;
+        crypto_info->u.gcm256.info.version = s->version;
+        crypto_info->tls_len = sizeof(crypto_info->u.gcm256);
+        return ktls_fill_gcm(crypto_info->u.gcm256.key,
+                             sizeof(crypto_info->u.gcm256.key),
+                             crypto_info->u.gcm256.salt,
+                             crypto_info->u.gcm256.iv,
+                             crypto_info->u.gcm256.rec_seq,
+                             key, keylen, iv, ivlen, rl_sequence);
+# endif
+# ifdef TLS_CIPHER_CHACHA20_POLY1305
+    case NID_chacha20_poly1305:
+        if (keylen != sizeof(crypto_info->u.chacha20poly1305.key)
+                || ivlen != sizeof(crypto_info->u.chacha20poly1305.iv))
+            return 0;
+        crypto_info->u.chacha20poly1305.info.cipher_type
+            = TLS_CIPHER_CHACHA20_POLY1305;
+        crypto_info->u.chacha20poly1305.info.version = s->version;
+        crypto_info->tls_len = sizeof(crypto_info->u.chacha20poly1305);
+        memcpy(crypto_info->u.chacha20poly1305.key, key, keylen);
+        memcpy(crypto_info->u.chacha20poly1305.iv, iv, ivlen);
+        memcpy(crypto_info->u.chacha20poly1305.rec_seq, rl_sequence,
+               SEQ_NUM_SIZE);
+        return 1;
+# endif
+    default:
+        return 0;
+    }
+}
+
+/*
+ * Try to hand the record protection for one direction over to the kernel
+ * once the keys for it have been installed. |key| and |iv| are the values
+ * that were just used to initialise the EVP_CIPHER_CTX for that direction.
+ * Returns 1 if the direction is now offloaded and 0 if libssl's own record
+ * layer remains in use, which is never an error: the kernel may simply lack
+ * the tls module or the negotiated parameters may not be supported by it.
+ */
+int ssl_ktls_start(SSL *s, int is_tx, const EVP_CIPHER *c,
+                   const unsigned char *key, size_t keylen,
+                   const unsigned char *iv, size_t ivlen)
+{
+    ktls_crypto_info_t crypto_info;
+    const unsigned char *rl_sequence;
+    BIO *bio;
+    int ret = 0;
+
+    if ((s->options & SSL_OP_ENABLE_KTLS) == 0 || SSL_IS_DTLS(s))
+        return 0;
+
+    if (s->version != TLS1_2_VERSION && s->version != TLS1_3_VERSION)
+        return 0;
+
+    if (s->compress != NULL || s->expand != NULL)
+        return 0;
+
+    /* ktls supports only the maximum fragment size */
+    if (ssl_get_max_send_fragment(s) != SSL3_RT_MAX_PLAIN_LENGTH
+            || (s->session != NULL
+                && USE_MAX_FRAGMENT_LENGTH_EXT(s->session)))
+        return 0;
+
+    /* ktls does not support record padding */
+    if (is_tx && SSL_IS_TLS13(s)
+            && (s->record_padding_cb != NULL || s->block_padding > 0))
+        return 0;
+
+    bio = is_tx ? s->wbio : s->rbio;
+    if (bio == NULL)
+        return 0;
+
+    /*
+     * The kernel takes over at the current position in the byte stream, so
+     * nothing may be left half processed in our own buffers. All future data
+     * will get encrypted by ktls: flush the BIO or skip ktls.
+     */
+    if (is_tx) {
+        if (RECORD_LAYER_write_pending(&s->rlayer) || BIO_flush(bio) <= 0)
+            return 0;
+        rl_sequence = RECORD_LAYER_get_write_sequence(&s->rlayer);
+    } else {
+        if (RECORD_LAYER_read_pending(&s->rlayer))
+            return 0;
+        rl_sequence = RECORD_LAYER_get_read_sequence(&s->rlayer);
+    }
+
+    if (!ktls_configure_crypto(s, c, &crypto_info, rl_sequence, key, keylen,
+                               iv, ivlen))
+        goto end;
+
+    if (BIO_set_ktls(bio, &crypto_info, is_tx) <= 0)
+        goto end;
+
+    /* ktls cannot be re-keyed by a TLSv1.2 renegotiation */
+    if (!SSL_IS_TLS13(s))
+        s->options |= SSL_OP_NO_RENEGOTIATION;
+    ret = 1;
+
+ end:
+    OPENSSL_cleanse(&crypto_info, sizeof(crypto_info));
+    return ret;
+}
+#endif
@@ -10,11 +10,54 @@
 #include "ssl_local.h"
 #include <openssl/bn.h>
 
+/*
+ * The items of a pqueue are kept in a list sorted by priority, which is what
+ * pqueue_peek(), pqueue_pop() and the iterator walk, and in a treap (a binary
+ * search tree that is kept balanced by giving each item a pseudo-random
+ * weight and rotating heavier items towards the root) that finds the place of
+ * a new item and looks items up in expected O(log n) time. On top of that,
+ * the queued priorities are nearly always a window of consecutive sequence
+ * numbers, so a ring indexed by the low bits of the priority finds most items
+ * directly.
+ * All of it lives in the items themselves, so inserting an item never needs
+ * to allocate memory.
+ */
+#define PQUEUE_RING_SIZE    32
+
 struct pqueue_st {
     pitem *items;
-    int count;
+    pitem *root;
+    pitem *ring[PQUEUE_RING_SIZE];
+    size_t count;
 };
 
+static ossl_inline size_t pitem_ring_slot(const unsigned char *prio64be)
+{
+    return prio64be[7] % PQUEUE_RING_SIZE;
+}
+
+/*
+ * The weight of an item, derived from its priority with the 64-bit finalizer
+ * of MurmurHash3. Every bit of the priority affects every bit of the result,
+ * so consecutive sequence numbers get unrelated weights, which the treap
+ * needs to stay balanced. Priorities picked to defeat the hash can still
+ * make it deeper, which costs time but not correctness.
+ */
+static uint32_t pitem_weight(const unsigned char *prio64be)
+{
+    uint64_t h = 0;
+    size_t i;
+
+    for (i = 0; i < 8; i++)
+        h = (h << 8) | prio64be[i];
+    h ^= h >> 33;
+    h *= ((uint64_t)0xff51afd7U << 32) | 0xed558ccdU;
+    h ^= h >> 33;
+    h *= ((uint64_t)0xc4ceb9feU << 32) | 0x1a85ec53U;
+    h ^= h >> 33;
+    return (uint32_t)(h >> 32);
+}
+
 pitem *pitem_new(unsigned char *prio64be, void *data)
 {
     pitem *item = OPENSSL_malloc(sizeof(*item));
@@ -27,6 +70,8 @@ pitem *pitem_new(unsigned char *prio64be, void *data)
     memcpy(item->priority, prio64be, sizeof(item->priority));
     item->data = data;
     item->next = NULL;
+    item->left = item->right = NULL;
+    item->weight = pitem_weight(prio64be);
     return item;
 }
 
@@ -50,38 +95,65 @@ void pqueue_free(pqueue *pq)
     OPENSSL_free(pq);
 }
 
-pitem *pqueue_insert(pqueue *pq, pitem *item)
+/*
+ * Insert |item| into the treap at |*link|. |*pred| is set to the item that
+ * precedes it in priority order, if any. Returns 0 for a duplicate.
+ */
+static int pqueue_treap_insert(pitem **link, pitem *item, pitem **pred)
 {
-    pitem *curr, *next;
+    pitem *node = *link, *child;
+    /* we can compare 64-bit value in big-endian encoding with memcmp:-) */
+    int cmp;
 
-    if (pq->items == NULL) {
-        pq->items = item;
-        return item;
+    if (node == NULL) {
+        *link = item;
+        return 1;
     }
 
-    for (curr = NULL, next = pq->items;
-         next != NULL; curr = next, next = next->next) {
-        /*
-         * we can compare 64-bit value in big-endian encoding with memcmp:-)
-         */
-        int cmp = memcmp(next->priority, item->priority, 8);
-        if (cmp > 0) {          /* next > item */
-            item->next = next;
+    cmp = memcmp(item->priority, node->priority, 8);
+    if (cmp == 0)               /* duplicates not allowed */
+        return 0;
+
+    if (cmp < 0) {
+        if (!pqueue_treap_insert(&node->left, item, pred))
+            return 0;
+        child = node->left;
+        if (child->weight > node->weight) {
+            node->left = child->right;
+            child->right = node;
+            *link = child;
+        }
+    } else {
+        *pred = node;
+        if (!pqueue_treap_insert(&node->right, item, pred))
+            return 0;
+        child = node->right;
+        if (child->weight > node->weight) {
+            node->right = child->left;
+            child->left = node;
+            *link = child;
+        }
+    }
+    return 1;
+}
 
-            if (curr == NULL)
-                pq->items = item;
-            else
-                curr->next = item;
+pitem *pqueue_insert(pqueue *pq, pitem *item)
+{
+    pitem *pred = NULL;
 
-            return item;
-        }
+    item->left = item->right = NULL;
+    if (!pqueue_treap_insert(&pq->root, item, &pred))
+        return NULL;
 
-        else if (cmp == 0)      /* duplicates not allowed */
-            return NULL;
+    if (pred == NULL) {
+        item->next = pq->items;
+        pq->items = item;
+    } else {
+        item->next = pred->next;
+        pred->next = item;
     }
-
-    item->next = NULL;
-    curr->next = item;
+    pq->ring[pitem_ring_slot(item->priority)] = item;
+    pq->count++;
 
     return item;
 }
@@ -94,36 +166,43 @@ pitem *pqueue_peek(pqueue *pq)
 pitem *pqueue_pop(pqueue *pq)
 {
     pitem *item = pq->items;
+    pitem **link;
+    size_t slot;
+
+    if (item == NULL)
+        return NULL;
+
+    pq->items = item->next;
+
+    /* The first item is the leftmost one in the treap and has no left child */
+    for (link = &pq->root; *link != item; link = &(*link)->left)
+        continue;
+    *link = item->right;
 
-    if (pq->items != NULL)
-        pq->items = pq->items->next;
+    slot = pitem_ring_slot(item->priority);
+    if (pq->ring[slot] == item)
+        pq->ring[slot] = NULL;
+    pq->count--;
 
     return item;
 }
 
 pitem *pqueue_find(pqueue *pq, unsigned char *prio64be)
 {
-    pitem *next;
-    pitem *found = NULL;
+    pitem *item = pq->ring[pitem_ring_slot(prio64be)];
+    int cmp;
 
-    if (pq->items == NULL)
-        return NULL;
+    if (item != NULL && memcmp(item->priority, prio64be, 8) == 0)
+        return item;
 
-    for (next = pq->items; next->next != NULL; next = next->next) {
-        if (memcmp(next->priority, prio64be, 8) == 0) {
-            found = next;
-            break;
-        }
+    for (item = pq->root; item != NULL; ) {
+        cmp = memcmp(prio64be, item->priority, 8);
+        if (cmp == 0)
+            return item;
+        item = cmp < 0 ? item->left : item->right;
     }
 
-    /* check the one last node */
-    if (memcmp(next->priority, prio64be, 8) == 0)
-        found = next;
-
-    if (!found)
-        return NULL;
-
-    return found;
+    return NULL;
 }
 
 pitem *pqueue_iterator(pqueue *pq)
@@ -147,12 +226,5 @@ pitem *pqueue_next(piterator *item)
 
 size_t pqueue_size(pqueue *pq)
 {
-    pitem *item = pq->items;
-    size_t count = 0;
-
-    while (item != NULL) {
-        count++;
-        item = item->next;
-    }
-    return count;
+    return pq->count;
 }
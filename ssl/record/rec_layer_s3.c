@@ -16,6 +16,7 @@
 #include <openssl/rand.h>
 #include "record_local.h"
 #include "../packet_local.h"
+#include "internal/bio.h"
 
 #if     defined(OPENSSL_SMALL_FOOTPRINT) || \
         !(      defined(AES_ASM) &&     ( \
@@ -202,10 +203,12 @@ int ssl3_read_n(SSL *s, size_t n, size_t max, int extend, int clearold,
         /* start with empty packet ... */
         if (left == 0)
             rb->offset = align;
-        else if (align != 0 && left >= SSL3_RT_HEADER_LENGTH) {
+        else if (align != 0 && clearold == 1
+                 && left >= SSL3_RT_HEADER_LENGTH) {
             /*
              * check if next packet length is large enough to justify payload
-             * alignment...
+             * alignment... Not when reading further records of a pipeline
+             * though, the earlier ones are still in use where they are.
              */
             pkt = rb->buf + rb->offset;
             if (pkt[0] == SSL3_RT_APPLICATION_DATA
@@ -268,8 +271,12 @@ int ssl3_read_n(SSL *s, size_t n, size_t max, int extend, int clearold,
         return -1;
     }
 
-    /* We always act like read_ahead is set for DTLS */
-    if (!s->rlayer.read_ahead && !SSL_IS_DTLS(s))
+    /*
+     * We always act like read_ahead is set for DTLS, and with ktls the kernel
+     * hands us whole records so we must offer it room for one
+     */
+    if (!s->rlayer.read_ahead && !SSL_IS_DTLS(s)
+            && !BIO_get_ktls_recv(s->rbio))
         /* ignore max parameter */
         max = n;
     else {
@@ -303,6 +310,15 @@ int ssl3_read_n(SSL *s, size_t n, size_t max, int extend, int clearold,
         }
 
         if (ret <= 0) {
+#ifndef OPENSSL_NO_KTLS
+            /* the kernel reports a failed record authentication as EBADMSG */
+            if (ret < 0 && get_last_sys_error() == EBADMSG
+                    && BIO_get_ktls_recv(s->rbio)) {
+                SSLfatal(s, SSL_AD_BAD_RECORD_MAC, SSL_F_SSL3_READ_N,
+                         SSL_R_DECRYPTION_FAILED_OR_BAD_RECORD_MAC);
+                return -1;
+            }
+#endif
             rb->left = left;
             if (s->mode & SSL_MODE_RELEASE_BUFFERS && !SSL_IS_DTLS(s))
                 if (len + left == 0)
@@ -330,6 +346,172 @@ int ssl3_read_n(SSL *s, size_t n, size_t max, int extend, int clearold,
     return 1;
 }
 
+/*
+ * With dynamic record sizing, application data is sent in records of at most
+ * dynrec.initial_size bytes until dynrec.ramp_bytes have been sent, so that
+ * the peer can start decrypting a response before all of a full sized record
+ * has arrived. A new connection starts out with small records, and so does
+ * one that has not written anything for dynrec.idle_timeout seconds, when the
+ * TCP congestion window is likely to have shrunk again.
+ */
+static void ssl3_dynrec_start_write(SSL *s)
+{
+    time_t now;
+
+    if (s->dynrec.initial_size == 0)
+        return;
+    now = time(NULL);
+    if (s->dynrec.idle_timeout > 0 && s->dynrec.sent > 0
+            && now - s->dynrec.last_write >= s->dynrec.idle_timeout) {
+        s->dynrec.sent = 0;
+        s->dynrec.resets++;
+    }
+    s->dynrec.last_write = now;
+}
+
+/* The record size limit dynamic record sizing imposes, or 0 for none */
+static size_t ssl3_dynrec_limit(SSL *s, int type)
+{
+    if (type != SSL3_RT_APPLICATION_DATA
+            || s->dynrec.initial_size == 0
+            || s->dynrec.sent >= s->dynrec.ramp_bytes)
+        return 0;
+    return s->dynrec.initial_size;
+}
+
+/*
+ * Large writes over an AES-GCM or ChaCha20-Poly1305 ciphersuite are sent in
+ * batches of 4 or 8 full records. A batch is built in one buffer, encrypted
+ * with a single call into the record encryption function and written out
+ * with a single BIO_write(), much like the multi-block path of the stitched
+ * CBC ciphers.
+ */
+#define AEAD_MULTIREC_MAX       8
+/* Header, explicit IV or TLSv1.3 content type, and tag of each record */
+#define AEAD_MULTIREC_OVERHEAD  (SSL3_RT_HEADER_LENGTH \
+                                 + EVP_GCM_TLS_EXPLICIT_IV_LEN \
+                                 + EVP_GCM_TLS_TAG_LEN)
+
+static int ssl3_aead_multirec_ok(SSL *s, int type, size_t len,
+                                 size_t max_send_fragment)
+{
+    const EVP_CIPHER *cipher;
+
+    if (type != SSL3_RT_APPLICATION_DATA
+            || len < 4 * max_send_fragment
+            || s->compress != NULL
+            || s->msg_callback != NULL
+            || s->enc_write_ctx == NULL
+            || s->statem.enc_write_state != ENC_WRITE_STATE_VALID
+            || BIO_get_ktls_send(s->wbio)
+            || ssl3_dynrec_limit(s, type) != 0)
+        return 0;
+
+    cipher = EVP_CIPHER_CTX_cipher(s->enc_write_ctx);
+    if (EVP_CIPHER_mode(cipher) != EVP_CIPH_GCM_MODE
+            && EVP_CIPHER_nid(cipher) != NID_chacha20_poly1305)
+        return 0;
+
+    /* Before TLSv1.3 the cipher is handed the records as a pipeline */
+    return SSL_TREAT_AS_TLS13(s)
+        || (SSL_USE_EXPLICIT_IV(s)
+            && (EVP_CIPHER_flags(cipher) & EVP_CIPH_FLAG_PIPELINE) != 0);
+}
+
+/*
+ * Encrypt |numrecs| records of |reclen| bytes each from |buf| into the write
+ * buffer and send them. Return values are as per ssl3_write_pending().
+ */
+static int ssl3_write_aead_multirec(SSL *s, int type, const unsigned char *buf,
+                                    size_t numrecs, size_t reclen,
+                                    size_t *written)
+{
+    SSL3_RECORD wr[AEAD_MULTIREC_MAX];
+    SSL3_BUFFER *wb = &s->rlayer.wbuf[0];
+    unsigned char *p, *start;
+    size_t eivlen = 0, inlen, enclen, align = 0, j;
+    int tls13 = SSL_TREAT_AS_TLS13(s), i;
+    unsigned int version = tls13 ? TLS1_2_VERSION : (unsigned int)s->version;
+
+    if (s->s3->alert_dispatch) {
+        i = s->method->ssl_dispatch_alert(s);
+        if (i <= 0) {
+            /* SSLfatal() already called if appropriate */
+            return i;
+        }
+    }
+
+    if (!tls13 && EVP_CIPHER_CTX_mode(s->enc_write_ctx) == EVP_CIPH_GCM_MODE)
+        eivlen = EVP_GCM_TLS_EXPLICIT_IV_LEN;
+    /*
+     * In TLSv1.3 the content type follows the data. Full records are never
+     * padded.
+     */
+    inlen = eivlen + reclen + (tls13 ? 1 : 0);
+    enclen = inlen + EVP_GCM_TLS_TAG_LEN;
+    if (numrecs > AEAD_MULTIREC_MAX || enclen > 0xffff
+            || numrecs * (SSL3_RT_HEADER_LENGTH + enclen)
+               > SSL3_BUFFER_get_len(wb)) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL3_WRITE_AEAD_MULTIREC,
+                 ERR_R_INTERNAL_ERROR);
+        return -1;
+    }
+
+#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD != 0
+    align = (size_t)SSL3_BUFFER_get_buf(wb) + SSL3_RT_HEADER_LENGTH;
+    align = SSL3_ALIGN_PAYLOAD - 1 - ((align - 1) % SSL3_ALIGN_PAYLOAD);
+    if (align + numrecs * (SSL3_RT_HEADER_LENGTH + enclen)
+            > SSL3_BUFFER_get_len(wb))
+        align = 0;
+#endif
+    start = p = SSL3_BUFFER_get_buf(wb) + align;
+
+    memset(wr, 0, sizeof(wr));
+    for (j = 0; j < numrecs; j++) {
+        *p++ = SSL3_RT_APPLICATION_DATA;
+        *p++ = (unsigned char)(version >> 8);
+        *p++ = (unsigned char)version;
+        *p++ = (unsigned char)(enclen >> 8);
+        *p++ = (unsigned char)enclen;
+
+        memcpy(p + eivlen, &buf[j * reclen], reclen);
+        if (tls13)
+            p[eivlen + reclen] = (unsigned char)type;
+
+        SSL3_RECORD_set_type(&wr[j], SSL3_RT_APPLICATION_DATA);
+        SSL3_RECORD_set_rec_version(&wr[j], version);
+        SSL3_RECORD_set_data(&wr[j], p);
+        SSL3_RECORD_reset_input(&wr[j]);
+        SSL3_RECORD_set_length(&wr[j], inlen);
+        p += enclen;
+    }
+
+    if (s->method->ssl3_enc->enc(s, wr, numrecs, 1) < 1) {
+        if (!ossl_statem_in_error(s)) {
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL3_WRITE_AEAD_MULTIREC,
+                     ERR_R_INTERNAL_ERROR);
+        }
+        return -1;
+    }
+    for (j = 0; j < numrecs; j++) {
+        if (SSL3_RECORD_get_length(&wr[j]) != enclen) {
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL3_WRITE_AEAD_MULTIREC,
+                     ERR_R_INTERNAL_ERROR);
+            return -1;
+        }
+    }
+
+    SSL3_BUFFER_set_offset(wb, align);
+    SSL3_BUFFER_set_left(wb, p - start);
+
+    s->rlayer.wpend_tot = numrecs * reclen;
+    s->rlayer.wpend_buf = buf;
+    s->rlayer.wpend_type = type;
+    s->rlayer.wpend_ret = numrecs * reclen;
+
+    return ssl3_write_pending(s, type, buf, numrecs * reclen, written);
+}
+
 /*
  * Call this to write data in records of type 'type' It will return <= 0 if
  * not all data has been sent or non-blocking IO.
@@ -394,8 +576,13 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, size_t len,
         if (i == 0) {
             return -1;
         }
+        /* Ramp up the record size again after a handshake */
+        s->dynrec.sent = 0;
     }
 
+    if (type == SSL3_RT_APPLICATION_DATA && tot == 0)
+        ssl3_dynrec_start_write(s);
+
     /*
      * first check if there is a SSL3_BUFFER still being written out.  This
      * will happen with non blocking IO
@@ -410,6 +597,8 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, size_t len,
             return i;
         }
         tot += tmpwrit;               /* this might be last fragment */
+        if (type == SSL3_RT_APPLICATION_DATA && s->dynrec.initial_size != 0)
+            s->dynrec.sent += tmpwrit;
     }
 #if !defined(OPENSSL_NO_MULTIBLOCK) && EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK
     /*
@@ -421,6 +610,7 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, size_t len,
     if (type == SSL3_RT_APPLICATION_DATA &&
         len >= 4 * (max_send_fragment = ssl_get_max_send_fragment(s)) &&
         s->compress == NULL && s->msg_callback == NULL &&
+        ssl3_dynrec_limit(s, type) == 0 &&
         !SSL_WRITE_ETM(s) && SSL_USE_EXPLICIT_IV(s) &&
         EVP_CIPHER_flags(EVP_CIPHER_CTX_cipher(s->enc_write_ctx)) &
         EVP_CIPH_FLAG_TLS1_1_MULTIBLOCK) {
@@ -574,7 +764,8 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, size_t len,
         || s->enc_write_ctx == NULL
         || !(EVP_CIPHER_flags(EVP_CIPHER_CTX_cipher(s->enc_write_ctx))
              & EVP_CIPH_FLAG_PIPELINE)
-        || !SSL_USE_EXPLICIT_IV(s))
+        || !SSL_USE_EXPLICIT_IV(s)
+        || BIO_get_ktls_send(s->wbio))
         maxpipes = 1;
     if (max_send_fragment == 0 || split_send_fragment == 0
         || split_send_fragment > max_send_fragment) {
@@ -587,24 +778,68 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, size_t len,
         return -1;
     }
 
+    if (maxpipes == 1 && ssl3_aead_multirec_ok(s, type, n, max_send_fragment)) {
+        size_t numrecs = (n >= 8 * max_send_fragment) ? 8 : 4;
+
+        if (!ssl3_setup_write_buffer(s, 1,
+                                     numrecs * (max_send_fragment
+                                                + AEAD_MULTIREC_OVERHEAD)
+                                     + SSL3_ALIGN_PAYLOAD)) {
+            /* SSLfatal() already called */
+            return -1;
+        }
+        for (;;) {
+            if (n < 8 * max_send_fragment)
+                numrecs = 4;
+            i = ssl3_write_aead_multirec(s, type, &buf[tot], numrecs,
+                                         max_send_fragment, &tmpwrit);
+            if (i <= 0) {
+                /* SSLfatal() already called if appropriate */
+                s->rlayer.wnum = tot;
+                return i;
+            }
+            n -= tmpwrit;
+            tot += tmpwrit;
+            if (n == 0 || (s->mode & SSL_MODE_ENABLE_PARTIAL_WRITE) != 0) {
+                ssl3_release_write_buffer(s);
+                *written = tot;
+                return 1;
+            }
+            if (n < 4 * max_send_fragment) {
+                /* The rest goes out in ordinary records */
+                ssl3_release_write_buffer(s);
+                break;
+            }
+        }
+    }
+
     for (;;) {
         size_t pipelens[SSL_MAX_PIPELINES], tmppipelen, remain;
-        size_t numpipes, j;
+        size_t numpipes, j, maxfrag, splitfrag, dynlimit;
+
+        maxfrag = max_send_fragment;
+        splitfrag = split_send_fragment;
+        dynlimit = ssl3_dynrec_limit(s, type);
+        if (dynlimit != 0 && dynlimit < maxfrag) {
+            maxfrag = dynlimit;
+            if (splitfrag > maxfrag)
+                splitfrag = maxfrag;
+        }
 
         if (n == 0)
             numpipes = 1;
         else
-            numpipes = ((n - 1) / split_send_fragment) + 1;
+            numpipes = ((n - 1) / splitfrag) + 1;
         if (numpipes > maxpipes)
             numpipes = maxpipes;
 
-        if (n / numpipes >= max_send_fragment) {
+        if (n / numpipes >= maxfrag) {
             /*
              * We have enough data to completely fill all available
              * pipelines
              */
             for (j = 0; j < numpipes; j++) {
-                pipelens[j] = max_send_fragment;
+                pipelens[j] = maxfrag;
             }
         } else {
             /* We can partially fill all available pipelines */
@@ -626,6 +861,12 @@ int ssl3_write_bytes(SSL *s, int type, const void *buf_, size_t len,
             return i;
         }
 
+        if (type == SSL3_RT_APPLICATION_DATA && s->dynrec.initial_size != 0) {
+            s->dynrec.sent += tmpwrit;
+            if (dynlimit != 0)
+                s->dynrec.small_records += numpipes;
+        }
+
         if (tmpwrit == n ||
             (type == SSL3_RT_APPLICATION_DATA &&
              (s->mode & SSL_MODE_ENABLE_PARTIAL_WRITE))) {
@@ -688,6 +929,30 @@ int do_ssl3_write(SSL *s, int type, const unsigned char *buf,
         /* if it went, fall through and send more stuff */
     }
 
+    if (BIO_get_ktls_send(s->wbio)) {
+        /*
+         * The kernel does the record framing and encryption, so hand it the
+         * caller's plaintext directly instead of copying it into wbuf.
+         */
+        wb = &s->rlayer.wbuf[0];
+        if (wb->buf != NULL && !SSL3_BUFFER_is_app_buffer(wb))
+            ssl3_release_write_buffer(s);
+        if (totlen == 0)
+            return 0;
+        s->rlayer.numwpipes = 1;
+        SSL3_BUFFER_set_buf(wb, (unsigned char *)buf);
+        SSL3_BUFFER_set_app_buffer(wb, 1);
+        SSL3_BUFFER_set_len(wb, totlen);
+        SSL3_BUFFER_set_offset(wb, 0);
+        SSL3_BUFFER_set_left(wb, totlen);
+
+        s->rlayer.wpend_tot = totlen;
+        s->rlayer.wpend_buf = buf;
+        s->rlayer.wpend_type = type;
+        s->rlayer.wpend_ret = totlen;
+        return ssl3_write_pending(s, type, buf, totlen, written);
+    }
+
     if (s->rlayer.numwpipes < numpipes) {
         if (!ssl3_setup_write_buffer(s, numpipes, 0)) {
             /* SSLfatal() already called */
@@ -1150,6 +1415,23 @@ int ssl3_write_pending(SSL *s, int type, const unsigned char *buf, size_t len,
         clear_sys_error();
         if (s->wbio != NULL) {
             s->rwstate = SSL_WRITING;
+
+            if (SSL3_BUFFER_is_app_buffer(&wb[currbuf])) {
+                /*
+                 * The data is still in the caller's buffer, which may have
+                 * moved if SSL_MODE_ACCEPT_MOVING_WRITE_BUFFER is set
+                 */
+                SSL3_BUFFER_set_buf(&wb[currbuf], (unsigned char *)buf);
+
+                /* non application data records are sent as control messages */
+                if (type != SSL3_RT_APPLICATION_DATA) {
+                    i = BIO_flush(s->wbio);
+                    if (i <= 0)
+                        return i;
+                    BIO_set_ktls_ctrl_msg(s->wbio, type);
+                }
+            }
+
             /* TODO(size_t): Convert this call */
             i = BIO_write(s->wbio, (char *)
                           &(SSL3_BUFFER_get_buf(&wb[currbuf])
@@ -1298,7 +1580,15 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
     do {
         /* get new records if necessary */
         if (num_recs == 0) {
+            /* The record is only decrypted into |buf| if it all fits */
+            if (type == SSL3_RT_APPLICATION_DATA && !peek
+                    && (s->mode & SSL_MODE_DECRYPT_TO_USER_BUFFER) != 0) {
+                s->rlayer.decrypt_buf = buf;
+                s->rlayer.decrypt_len = len;
+            }
             ret = ssl3_get_record(s);
+            s->rlayer.decrypt_buf = NULL;
+            s->rlayer.decrypt_len = 0;
             if (ret <= 0) {
                 /* SSLfatal() already called if appropriate */
                 return ret;
@@ -1408,7 +1698,9 @@ int ssl3_read_bytes(SSL *s, int type, int *recvd_type, unsigned char *buf,
             else
                 n = len - totalbytes;
 
-            memcpy(buf, &(rr->data[rr->off]), n);
+            /* Nothing to copy if the record was decrypted into |buf| */
+            if (buf != &(rr->data[rr->off]))
+                memcpy(buf, &(rr->data[rr->off]), n);
             buf += n;
             if (peek) {
                 /* Mark any zero length record as consumed CVE-2016-6305 */
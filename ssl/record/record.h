@@ -25,8 +25,13 @@ typedef struct ssl3_buffer_st {
     size_t offset;
     /* how many bytes left */
     size_t left;
+    /* 'buf' is owned by the application (kTLS writes) and is never freed */
+    int app_buffer;
 } SSL3_BUFFER;
 
+/* A pool of record buffers shared by the connections of an SSL_CTX */
+typedef struct ssl3_buffer_pool_st SSL3_BUFFER_POOL;
+
 #define SEQ_NUM_SIZE                            8
 
 typedef struct ssl3_record_st {
@@ -166,6 +171,12 @@ typedef struct record_layer_st {
     unsigned int is_first_record;
     /* Count of the number of consecutive warning alerts received */
     unsigned int alert_count;
+    /*
+     * The caller's buffer that ssl3_get_record() may decrypt an application
+     * data record into, see SSL_MODE_DECRYPT_TO_USER_BUFFER
+     */
+    unsigned char *decrypt_buf;
+    size_t decrypt_len;
     DTLS_RECORD_LAYER *d;
 } RECORD_LAYER;
 
@@ -190,6 +201,8 @@ typedef struct record_layer_st {
                                                 ((rl)->d->unprocessed_rcds)
 #define RECORD_LAYER_get_rbuf(rl)               (&(rl)->rbuf)
 #define RECORD_LAYER_get_wbuf(rl)               ((rl)->wbuf)
+#define RECORD_LAYER_get_read_sequence(rl)      ((rl)->read_sequence)
+#define RECORD_LAYER_get_write_sequence(rl)     ((rl)->write_sequence)
 
 void RECORD_LAYER_init(RECORD_LAYER *rl, SSL *s);
 void RECORD_LAYER_clear(RECORD_LAYER *rl);
@@ -211,6 +224,12 @@ __owur int ssl3_read_bytes(SSL *s, int type, int *recvd_type,
                            unsigned char *buf, size_t len, int peek,
                            size_t *readbytes);
 __owur int ssl3_setup_buffers(SSL *s);
+__owur int ssl3_buffer_pool_set_size(SSL_CTX *ctx, size_t num);
+void ssl3_buffer_pool_free(SSL3_BUFFER_POOL *pool);
+size_t ssl3_buffer_pool_get_size(const SSL_CTX *ctx);
+size_t ssl3_buffer_pool_hits(const SSL_CTX *ctx);
+size_t ssl3_buffer_pool_misses(const SSL_CTX *ctx);
+size_t ssl3_buffer_pool_bytes(const SSL_CTX *ctx);
 __owur int ssl3_enc(SSL *s, SSL3_RECORD *inrecs, size_t n_recs, int send);
 __owur int n_ssl3_mac(SSL *ssl, SSL3_RECORD *rec, unsigned char *md, int send);
 __owur int ssl3_write_pending(SSL *s, int type, const unsigned char *buf, size_t len,
@@ -10,6 +10,294 @@
 #include "../ssl_local.h"
 #include "record_local.h"
 
+/*
+ * The buffer pool of an SSL_CTX keeps the record buffers that its connections
+ * release, so that SSL_MODE_RELEASE_BUFFERS doesn't mean going back to the
+ * allocator for every record. Read and write buffers are kept apart, and
+ * each list only holds buffers of one size: that of the first buffer put on
+ * it while it is empty, which in practice follows the read buffer length and
+ * max send fragment settings of the SSL_CTX. Buffers of any other size are
+ * simply freed, as are the larger write buffers used for multi-block and
+ * batched AEAD writes.
+ *
+ * Each thread uses one of SSL3_BUFFER_POOL_SHARDS shards picked by its thread
+ * ID, so that threads seldom share a lock. A shard keeps a few buffers of its
+ * own and passes the rest on to the depot shared by all threads, which holds
+ * up to the number of buffers set with SSL_CTX_set_buffer_pool_size().
+ *
+ * Connections find the pool through their SSL_CTX without a lock, so it can
+ * only be created or freed until the first SSL is created from the SSL_CTX.
+ * After that only its size can change.
+ */
+#define SSL3_BUFFER_POOL_SHARDS     8
+#define SSL3_BUFFER_POOL_SHARD_MAX  4
+
+#define SSL3_BUFFER_POOL_READ       0
+#define SSL3_BUFFER_POOL_WRITE      1
+
+typedef struct ssl3_buffer_list_st {
+    /* Idle buffers, each holding a pointer to the next in its first bytes */
+    unsigned char *head;
+    size_t num;
+    size_t len;
+} SSL3_BUFFER_LIST;
+
+typedef struct ssl3_buffer_shard_st {
+    CRYPTO_RWLOCK *lock;
+    SSL3_BUFFER_LIST lists[2];
+    size_t hits;
+    size_t misses;
+} SSL3_BUFFER_SHARD;
+
+struct ssl3_buffer_pool_st {
+    TSAN_QUALIFIER size_t max;
+    SSL3_BUFFER_SHARD depot;
+    SSL3_BUFFER_SHARD shards[SSL3_BUFFER_POOL_SHARDS];
+};
+
+/* The size of the write buffers of |s|, unless a larger one is asked for */
+static size_t ssl3_default_write_buffer_len(SSL *s)
+{
+    size_t len, align = 0, headerlen;
+
+    if (SSL_IS_DTLS(s))
+        headerlen = DTLS1_RT_HEADER_LENGTH + 1;
+    else
+        headerlen = SSL3_RT_HEADER_LENGTH;
+
+#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
+    align = (-SSL3_RT_HEADER_LENGTH) & (SSL3_ALIGN_PAYLOAD - 1);
+#endif
+
+    len = ssl_get_max_send_fragment(s)
+        + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD + headerlen + align;
+#ifndef OPENSSL_NO_COMP
+    if (ssl_allow_compression(s))
+        len += SSL3_RT_MAX_COMPRESSED_OVERHEAD;
+#endif
+    if (!(s->options & SSL_OP_DONT_INSERT_EMPTY_FRAGMENTS))
+        len += headerlen + align + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
+    return len;
+}
+
+static unsigned char *buffer_list_pop(SSL3_BUFFER_LIST *l, size_t len)
+{
+    unsigned char *p;
+
+    if (l->num == 0 || l->len != len)
+        return NULL;
+    p = l->head;
+    memcpy(&l->head, p, sizeof(l->head));
+    l->num--;
+    return p;
+}
+
+static int buffer_list_push(SSL3_BUFFER_LIST *l, unsigned char *p, size_t len,
+                            size_t max)
+{
+    if (l->num >= max || (l->num > 0 && l->len != len))
+        return 0;
+    memcpy(p, &l->head, sizeof(l->head));
+    l->head = p;
+    l->len = len;
+    l->num++;
+    return 1;
+}
+
+/* Free the buffers of |l| beyond the first |max| */
+static void buffer_list_trim(SSL3_BUFFER_LIST *l, size_t max)
+{
+    unsigned char *p;
+
+    while (l->num > max) {
+        p = buffer_list_pop(l, l->len);
+        OPENSSL_free(p);
+    }
+}
+
+static SSL3_BUFFER_SHARD *buffer_pool_shard(SSL3_BUFFER_POOL *pool)
+{
+    CRYPTO_THREAD_ID id = CRYPTO_THREAD_get_current_id();
+    const unsigned char *p = (const unsigned char *)&id;
+    size_t i, h = 0;
+
+    for (i = 0; i < sizeof(id); i++)
+        h = h * 31 + p[i];
+    return &pool->shards[h % SSL3_BUFFER_POOL_SHARDS];
+}
+
+static unsigned char *ssl3_buffer_get(SSL *s, int kind, size_t len)
+{
+    SSL3_BUFFER_POOL *pool = s->ctx->buffer_pool;
+    SSL3_BUFFER_SHARD *shard;
+    unsigned char *p;
+
+    if (pool == NULL
+            || (kind == SSL3_BUFFER_POOL_WRITE
+                && len != ssl3_default_write_buffer_len(s)))
+        return OPENSSL_malloc(len);
+
+    shard = buffer_pool_shard(pool);
+    CRYPTO_THREAD_write_lock(shard->lock);
+    if ((p = buffer_list_pop(&shard->lists[kind], len)) == NULL) {
+        CRYPTO_THREAD_write_lock(pool->depot.lock);
+        p = buffer_list_pop(&pool->depot.lists[kind], len);
+        CRYPTO_THREAD_unlock(pool->depot.lock);
+    }
+    if (p != NULL)
+        shard->hits++;
+    else
+        shard->misses++;
+    CRYPTO_THREAD_unlock(shard->lock);
+
+    return p != NULL ? p : OPENSSL_malloc(len);
+}
+
+static void ssl3_buffer_put(SSL *s, int kind, unsigned char *buf, size_t len)
+{
+    SSL3_BUFFER_POOL *pool = s->ctx->buffer_pool;
+    SSL3_BUFFER_SHARD *shard;
+    size_t max;
+    int ok;
+
+    if (pool == NULL || buf == NULL
+            || (kind == SSL3_BUFFER_POOL_WRITE
+                && len != ssl3_default_write_buffer_len(s))) {
+        OPENSSL_free(buf);
+        return;
+    }
+
+    max = tsan_load(&pool->max);
+    shard = buffer_pool_shard(pool);
+    CRYPTO_THREAD_write_lock(shard->lock);
+    ok = buffer_list_push(&shard->lists[kind], buf, len,
+                          max < SSL3_BUFFER_POOL_SHARD_MAX
+                          ? max : SSL3_BUFFER_POOL_SHARD_MAX);
+    CRYPTO_THREAD_unlock(shard->lock);
+    if (!ok) {
+        CRYPTO_THREAD_write_lock(pool->depot.lock);
+        ok = buffer_list_push(&pool->depot.lists[kind], buf, len,
+                              tsan_load(&pool->max));
+        CRYPTO_THREAD_unlock(pool->depot.lock);
+    }
+    if (!ok)
+        OPENSSL_free(buf);
+}
+
+static void buffer_shard_free(SSL3_BUFFER_SHARD *shard)
+{
+    buffer_list_trim(&shard->lists[SSL3_BUFFER_POOL_READ], 0);
+    buffer_list_trim(&shard->lists[SSL3_BUFFER_POOL_WRITE], 0);
+    CRYPTO_THREAD_lock_free(shard->lock);
+}
+
+void ssl3_buffer_pool_free(SSL3_BUFFER_POOL *pool)
+{
+    size_t i;
+
+    if (pool == NULL)
+        return;
+    buffer_shard_free(&pool->depot);
+    for (i = 0; i < SSL3_BUFFER_POOL_SHARDS; i++)
+        buffer_shard_free(&pool->shards[i]);
+    OPENSSL_free(pool);
+}
+
+int ssl3_buffer_pool_set_size(SSL_CTX *ctx, size_t num)
+{
+    SSL3_BUFFER_POOL *pool = ctx->buffer_pool;
+    size_t i;
+
+    /* Connections use the pool without a lock once there are any */
+    if ((num == 0 || pool == NULL) && tsan_load(&ctx->in_use)) {
+        if (num == 0 && pool == NULL)
+            return 1;
+        SSLerr(SSL_F_SSL3_BUFFER_POOL_SET_SIZE,
+               ERR_R_SHOULD_NOT_HAVE_BEEN_CALLED);
+        return 0;
+    }
+
+    if (num == 0) {
+        ssl3_buffer_pool_free(pool);
+        ctx->buffer_pool = NULL;
+        return 1;
+    }
+
+    if (pool != NULL) {
+        CRYPTO_THREAD_write_lock(pool->depot.lock);
+        tsan_store(&pool->max, num);
+        buffer_list_trim(&pool->depot.lists[SSL3_BUFFER_POOL_READ], num);
+        buffer_list_trim(&pool->depot.lists[SSL3_BUFFER_POOL_WRITE], num);
+        CRYPTO_THREAD_unlock(pool->depot.lock);
+        return 1;
+    }
+
+    if ((pool = OPENSSL_zalloc(sizeof(*pool))) == NULL
+            || (pool->depot.lock = CRYPTO_THREAD_lock_new()) == NULL)
+        goto err;
+    for (i = 0; i < SSL3_BUFFER_POOL_SHARDS; i++)
+        if ((pool->shards[i].lock = CRYPTO_THREAD_lock_new()) == NULL)
+            goto err;
+    pool->max = num;
+    ctx->buffer_pool = pool;
+    return 1;
+
+ err:
+    ssl3_buffer_pool_free(pool);
+    SSLerr(SSL_F_SSL3_BUFFER_POOL_SET_SIZE, ERR_R_MALLOC_FAILURE);
+    return 0;
+}
+
+size_t ssl3_buffer_pool_get_size(const SSL_CTX *ctx)
+{
+    return ctx->buffer_pool != NULL ? tsan_load(&ctx->buffer_pool->max) : 0;
+}
+
+#define BUFFER_POOL_HITS    0
+#define BUFFER_POOL_MISSES  1
+#define BUFFER_POOL_BYTES   2
+
+/* Add up |what| over the shards and the depot of the pool of |ctx| */
+static size_t buffer_pool_sum(const SSL_CTX *ctx, int what)
+{
+    SSL3_BUFFER_POOL *pool = ctx->buffer_pool;
+    SSL3_BUFFER_SHARD *shard;
+    size_t i, ret = 0;
+
+    if (pool == NULL)
+        return 0;
+    for (i = 0; i <= SSL3_BUFFER_POOL_SHARDS; i++) {
+        shard = i < SSL3_BUFFER_POOL_SHARDS ? &pool->shards[i] : &pool->depot;
+        CRYPTO_THREAD_read_lock(shard->lock);
+        if (what == BUFFER_POOL_HITS)
+            ret += shard->hits;
+        else if (what == BUFFER_POOL_MISSES)
+            ret += shard->misses;
+        else
+            ret += shard->lists[SSL3_BUFFER_POOL_READ].num
+                   * shard->lists[SSL3_BUFFER_POOL_READ].len
+                   + shard->lists[SSL3_BUFFER_POOL_WRITE].num
+                   * shard->lists[SSL3_BUFFER_POOL_WRITE].len;
+        CRYPTO_THREAD_unlock(shard->lock);
+    }
+    return ret;
+}
+
+size_t ssl3_buffer_pool_hits(const SSL_CTX *ctx)
+{
+    return buffer_pool_sum(ctx, BUFFER_POOL_HITS);
+}
+
+size_t ssl3_buffer_pool_misses(const SSL_CTX *ctx)
+{
+    return buffer_pool_sum(ctx, BUFFER_POOL_MISSES);
+}
+
+size_t ssl3_buffer_pool_bytes(const SSL_CTX *ctx)
+{
+    return buffer_pool_sum(ctx, BUFFER_POOL_BYTES);
+}
+
 void SSL3_BUFFER_set_data(SSL3_BUFFER *b, const unsigned char *d, size_t n)
 {
     if (d != NULL)
@@ -60,7 +348,7 @@ int ssl3_setup_read_buffer(SSL *s)
 #endif
         if (b->default_len > len)
             len = b->default_len;
-        if ((p = OPENSSL_malloc(len)) == NULL) {
+        if ((p = ssl3_buffer_get(s, SSL3_BUFFER_POOL_READ, len)) == NULL) {
             /*
              * We've got a malloc failure, and we're still initialising buffers.
              * We assume we're so doomed that we won't even be able to send an
@@ -81,43 +369,32 @@ int ssl3_setup_read_buffer(SSL *s)
 int ssl3_setup_write_buffer(SSL *s, size_t numwpipes, size_t len)
 {
     unsigned char *p;
-    size_t align = 0, headerlen;
     SSL3_BUFFER *wb;
     size_t currpipe;
 
     s->rlayer.numwpipes = numwpipes;
 
-    if (len == 0) {
-        if (SSL_IS_DTLS(s))
-            headerlen = DTLS1_RT_HEADER_LENGTH + 1;
-        else
-            headerlen = SSL3_RT_HEADER_LENGTH;
-
-#if defined(SSL3_ALIGN_PAYLOAD) && SSL3_ALIGN_PAYLOAD!=0
-        align = (-SSL3_RT_HEADER_LENGTH) & (SSL3_ALIGN_PAYLOAD - 1);
-#endif
-
-        len = ssl_get_max_send_fragment(s)
-            + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD + headerlen + align;
-#ifndef OPENSSL_NO_COMP
-        if (ssl_allow_compression(s))
-            len += SSL3_RT_MAX_COMPRESSED_OVERHEAD;
-#endif
-        if (!(s->options & SSL_OP_DONT_INSERT_EMPTY_FRAGMENTS))
-            len += headerlen + align + SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD;
-    }
+    if (len == 0)
+        len = ssl3_default_write_buffer_len(s);
 
     wb = RECORD_LAYER_get_wbuf(&s->rlayer);
     for (currpipe = 0; currpipe < numwpipes; currpipe++) {
         SSL3_BUFFER *thiswb = &wb[currpipe];
 
+        /* Never free or reuse a buffer owned by the application */
+        if (SSL3_BUFFER_is_app_buffer(thiswb)) {
+            SSL3_BUFFER_set_app_buffer(thiswb, 0);
+            thiswb->buf = NULL;
+        }
+
         if (thiswb->buf != NULL && thiswb->len != len) {
-            OPENSSL_free(thiswb->buf);
+            ssl3_buffer_put(s, SSL3_BUFFER_POOL_WRITE, thiswb->buf,
+                            thiswb->len);
             thiswb->buf = NULL;         /* force reallocation */
         }
 
         if (thiswb->buf == NULL) {
-            p = OPENSSL_malloc(len);
+            p = ssl3_buffer_get(s, SSL3_BUFFER_POOL_WRITE, len);
             if (p == NULL) {
                 s->rlayer.numwpipes = currpipe;
                 /*
@@ -160,7 +437,10 @@ int ssl3_release_write_buffer(SSL *s)
     while (pipes > 0) {
         wb = &RECORD_LAYER_get_wbuf(&s->rlayer)[pipes - 1];
 
-        OPENSSL_free(wb->buf);
+        if (SSL3_BUFFER_is_app_buffer(wb))
+            SSL3_BUFFER_set_app_buffer(wb, 0);
+        else
+            ssl3_buffer_put(s, SSL3_BUFFER_POOL_WRITE, wb->buf, wb->len);
         wb->buf = NULL;
         pipes--;
     }
@@ -173,7 +453,7 @@ int ssl3_release_read_buffer(SSL *s)
     SSL3_BUFFER *b;
 
     b = RECORD_LAYER_get_rbuf(&s->rlayer);
-    OPENSSL_free(b->buf);
+    ssl3_buffer_put(s, SSL3_BUFFER_POOL_READ, b->buf, b->len);
     b->buf = NULL;
     return 1;
 }
@@ -186,6 +186,7 @@ int ssl3_get_record(SSL *s)
     size_t num_recs = 0, max_recs, j;
     PACKET pkt, sslv2pkt;
     size_t first_rec_len;
+    int using_ktls;
 
     rr = RECORD_LAYER_get_rrec(&s->rlayer);
     rbuf = RECORD_LAYER_get_rbuf(&s->rlayer);
@@ -194,6 +195,14 @@ int ssl3_get_record(SSL *s)
         max_recs = 1;
     sess = s->session;
 
+    /*
+     * If we are using ktls the kernel has already decrypted and authenticated
+     * the records, and it hands them to us one at a time
+     */
+    using_ktls = BIO_get_ktls_recv(s->rbio);
+    if (using_ktls)
+        max_recs = 1;
+
     do {
         thisrr = &rr[num_recs];
 
@@ -339,7 +348,8 @@ int ssl3_get_record(SSL *s)
                     }
                 }
 
-                if (SSL_IS_TLS13(s) && s->enc_read_ctx != NULL) {
+                if (SSL_IS_TLS13(s) && s->enc_read_ctx != NULL
+                        && !using_ktls) {
                     if (thisrr->type != SSL3_RT_APPLICATION_DATA
                             && (thisrr->type != SSL3_RT_CHANGE_CIPHER_SPEC
                                 || !SSL_IS_FIRST_HANDSHAKE(s))
@@ -491,6 +501,10 @@ int ssl3_get_record(SSL *s)
         return 1;
     }
 
+    /* the kernel has already decrypted the record and checked its tag */
+    if (using_ktls)
+        goto skip_decryption;
+
     /*
      * If in encrypt-then-mac mode calculate mac from encrypted record. All
      * the details below are public so no timing details can leak.
@@ -524,10 +538,32 @@ int ssl3_get_record(SSL *s)
         }
     }
 
+    /*
+     * tls13_enc() does not decrypt in place, so a TLSv1.3 application data
+     * record can be decrypted straight into the caller's buffer if that has
+     * room for all of it.
+     */
+    if (s->rlayer.decrypt_buf != NULL
+            && num_recs == 1
+            && SSL_IS_TLS13(s)
+            && s->enc_read_ctx != NULL
+            && rr[0].type == SSL3_RT_APPLICATION_DATA
+            && rr[0].length <= s->rlayer.decrypt_len)
+        rr[0].data = s->rlayer.decrypt_buf;
+
     first_rec_len = rr[0].length;
 
     enc_err = s->method->ssl3_enc->enc(s, rr, num_recs, 0);
 
+    /*
+     * Don't leave plaintext that failed authentication in the caller's
+     * buffer, the record is discarded anyway.
+     */
+    if (enc_err <= 0 && rr[0].data == s->rlayer.decrypt_buf) {
+        OPENSSL_cleanse(rr[0].data, first_rec_len);
+        rr[0].data = rr[0].input;
+    }
+
     /*-
      * enc_err is:
      *    0: (in non-constant time) if the record is publicly invalid.
@@ -678,6 +714,8 @@ int ssl3_get_record(SSL *s)
         return -1;
     }
 
+ skip_decryption:
+
     for (j = 0; j < num_recs; j++) {
         thisrr = &rr[j];
 
@@ -697,7 +735,8 @@ int ssl3_get_record(SSL *s)
 
         if (SSL_IS_TLS13(s)
                 && s->enc_read_ctx != NULL
-                && thisrr->type != SSL3_RT_ALERT) {
+                && thisrr->type != SSL3_RT_ALERT
+                && !using_ktls) {
             size_t end;
 
             if (thisrr->length == 0
@@ -724,6 +763,16 @@ int ssl3_get_record(SSL *s)
             if (s->msg_callback)
                 s->msg_callback(0, s->version, SSL3_RT_INNER_CONTENT_TYPE,
                                 &thisrr->data[end], 1, s, s->msg_callback_arg);
+
+            /*
+             * Only application data is guaranteed to be consumed by the
+             * current read, anything else goes back into the read buffer
+             */
+            if (thisrr->data == s->rlayer.decrypt_buf
+                    && thisrr->type != SSL3_RT_APPLICATION_DATA) {
+                memcpy(thisrr->input, thisrr->data, thisrr->length);
+                thisrr->data = thisrr->input;
+            }
         }
 
         /*
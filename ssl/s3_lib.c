@@ -3316,6 +3316,7 @@ void ssl3_free(SSL *s)
         return;
 
     ssl3_cleanup_key_block(s);
+    HMAC_CTX_free(s->s3->hkdf_hmac);
 
 #if !defined(OPENSSL_NO_EC) || !defined(OPENSSL_NO_DH)
     EVP_PKEY_free(s->s3->peer_tmp);
@@ -3326,6 +3327,7 @@ void ssl3_free(SSL *s)
 
     OPENSSL_free(s->s3->tmp.ctype);
     sk_X509_NAME_pop_free(s->s3->tmp.peer_ca_names, X509_NAME_free);
+    ssl_cert_comp_free(s->s3->tmp.cert_comp);
     OPENSSL_free(s->s3->tmp.ciphers_raw);
     OPENSSL_clear_free(s->s3->tmp.pms, s->s3->tmp.pmslen);
     OPENSSL_free(s->s3->tmp.peer_sigalgs);
@@ -3344,8 +3346,10 @@ void ssl3_free(SSL *s)
 int ssl3_clear(SSL *s)
 {
     ssl3_cleanup_key_block(s);
+    HMAC_CTX_free(s->s3->hkdf_hmac);
     OPENSSL_free(s->s3->tmp.ctype);
     sk_X509_NAME_pop_free(s->s3->tmp.peer_ca_names, X509_NAME_free);
+    ssl_cert_comp_free(s->s3->tmp.cert_comp);
     OPENSSL_free(s->s3->tmp.ciphers_raw);
     OPENSSL_clear_free(s->s3->tmp.pms, s->s3->tmp.pmslen);
     OPENSSL_free(s->s3->tmp.peer_sigalgs);
@@ -3836,16 +3840,15 @@ long ssl3_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
                 return 0;
             }
             if (cmd == SSL_CTRL_SET_TLSEXT_TICKET_KEYS) {
-                memcpy(ctx->ext.tick_key_name, keys,
-                       sizeof(ctx->ext.tick_key_name));
-                memcpy(ctx->ext.secure->tick_hmac_key,
-                       keys + sizeof(ctx->ext.tick_key_name),
-                       sizeof(ctx->ext.secure->tick_hmac_key));
-                memcpy(ctx->ext.secure->tick_aes_key,
-                       keys + sizeof(ctx->ext.tick_key_name) +
-                       sizeof(ctx->ext.secure->tick_hmac_key),
-                       sizeof(ctx->ext.secure->tick_aes_key));
+                if (!tls1_set_ticket_key(ctx, keys,
+                                         keys + sizeof(ctx->ext.tick_key_name),
+                                         keys + sizeof(ctx->ext.tick_key_name) +
+                                         sizeof(ctx->ext.secure->tick_hmac_key))) {
+                    SSLerr(SSL_F_SSL3_CTX_CTRL, ERR_R_INTERNAL_ERROR);
+                    return 0;
+                }
             } else {
+                CRYPTO_THREAD_read_lock(ctx->ext.tick_keys_lock);
                 memcpy(keys, ctx->ext.tick_key_name,
                        sizeof(ctx->ext.tick_key_name));
                 memcpy(keys + sizeof(ctx->ext.tick_key_name),
@@ -3855,10 +3858,28 @@ long ssl3_ctx_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
                        sizeof(ctx->ext.secure->tick_hmac_key),
                        ctx->ext.secure->tick_aes_key,
                        sizeof(ctx->ext.secure->tick_aes_key));
+                CRYPTO_THREAD_unlock(ctx->ext.tick_keys_lock);
             }
             return 1;
         }
 
+    case SSL_CTRL_SET_TLSEXT_TICKET_KEY_HISTORY:
+        if (larg < 0 || !tls1_set_ticket_key_history(ctx, (size_t)larg)) {
+            SSLerr(SSL_F_SSL3_CTX_CTRL, SSL_R_INVALID_TICKET_KEY_HISTORY);
+            return 0;
+        }
+        return 1;
+
+    case SSL_CTRL_GET_TLSEXT_TICKET_KEY_HISTORY:
+        return (long)ctx->ext.tick_key_history;
+
+    case SSL_CTRL_ROTATE_TLSEXT_TICKET_KEYS:
+        if (!tls1_new_ticket_key(ctx)) {
+            SSLerr(SSL_F_SSL3_CTX_CTRL, ERR_R_INTERNAL_ERROR);
+            return 0;
+        }
+        return 1;
+
     case SSL_CTRL_GET_TLSEXT_STATUS_REQ_TYPE:
         return ctx->ext.status_type;
 
@@ -4696,35 +4717,44 @@ EVP_PKEY *ssl_generate_pkey(EVP_PKEY *pm)
 }
 #ifndef OPENSSL_NO_EC
 /* Generate a private key from a group ID */
+/* Set up an EVP_PKEY_CTX for generating keys in the group |ginf| */
+static EVP_PKEY_CTX *group_keygen_ctx(const TLS_GROUP_INFO *ginf)
+{
+    EVP_PKEY_CTX *pctx;
+    uint16_t gtype = ginf->flags & TLS_CURVE_TYPE;
+
+    if (gtype == TLS_CURVE_CUSTOM)
+        pctx = EVP_PKEY_CTX_new_id(ginf->nid, NULL);
+    else
+        pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL);
+    if (pctx == NULL)
+        return NULL;
+    if (EVP_PKEY_keygen_init(pctx) <= 0
+            || (gtype != TLS_CURVE_CUSTOM
+                && EVP_PKEY_CTX_set_ec_paramgen_curve_nid(pctx,
+                                                          ginf->nid) <= 0)) {
+        EVP_PKEY_CTX_free(pctx);
+        return NULL;
+    }
+    return pctx;
+}
+
 EVP_PKEY *ssl_generate_pkey_group(SSL *s, uint16_t id)
 {
     EVP_PKEY_CTX *pctx = NULL;
     EVP_PKEY *pkey = NULL;
     const TLS_GROUP_INFO *ginf = tls1_group_id_lookup(id);
-    uint16_t gtype;
 
     if (ginf == NULL) {
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_GENERATE_PKEY_GROUP,
                  ERR_R_INTERNAL_ERROR);
         goto err;
     }
-    gtype = ginf->flags & TLS_CURVE_TYPE;
-    if (gtype == TLS_CURVE_CUSTOM)
-        pctx = EVP_PKEY_CTX_new_id(ginf->nid, NULL);
-    else
-        pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_EC, NULL);
+    pkey = ssl_ctx_eph_key_pool_get(s->ctx, id);
+    if (pkey != NULL)
+        return pkey;
+    pctx = group_keygen_ctx(ginf);
     if (pctx == NULL) {
-        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_GENERATE_PKEY_GROUP,
-                 ERR_R_MALLOC_FAILURE);
-        goto err;
-    }
-    if (EVP_PKEY_keygen_init(pctx) <= 0) {
-        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_GENERATE_PKEY_GROUP,
-                 ERR_R_EVP_LIB);
-        goto err;
-    }
-    if (gtype != TLS_CURVE_CUSTOM
-            && EVP_PKEY_CTX_set_ec_paramgen_curve_nid(pctx, ginf->nid) <= 0) {
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_GENERATE_PKEY_GROUP,
                  ERR_R_EVP_LIB);
         goto err;
@@ -4741,6 +4771,30 @@ EVP_PKEY *ssl_generate_pkey_group(SSL *s, uint16_t id)
     return pkey;
 }
 
+/*
+ * Generate up to |n| private keys in the group |id| into |keys|, sharing one
+ * EVP_PKEY_CTX between them. Returns the number of keys generated.
+ */
+size_t ssl_generate_pkey_group_batch(uint16_t id, EVP_PKEY **keys, size_t n)
+{
+    EVP_PKEY_CTX *pctx;
+    const TLS_GROUP_INFO *ginf = tls1_group_id_lookup(id);
+    size_t i;
+
+    if (ginf == NULL || (pctx = group_keygen_ctx(ginf)) == NULL)
+        return 0;
+    for (i = 0; i < n; i++) {
+        keys[i] = NULL;
+        if (EVP_PKEY_keygen(pctx, &keys[i]) <= 0) {
+            EVP_PKEY_free(keys[i]);
+            keys[i] = NULL;
+            break;
+        }
+    }
+    EVP_PKEY_CTX_free(pctx);
+    return i;
+}
+
 /*
  * Generate parameters from a group ID
  */
@@ -47,9 +47,158 @@ int SSL_get_ex_data_X509_STORE_CTX_idx(void)
     return ssl_x509_store_ctx_idx;
 }
 
+static SSL_CERT_MSG_CACHE *ssl_cert_msg_cache_new(void)
+{
+    SSL_CERT_MSG_CACHE *cache = OPENSSL_zalloc(sizeof(*cache));
+
+    if (cache == NULL)
+        return NULL;
+    cache->references = 1;
+    if ((cache->lock = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(cache);
+        return NULL;
+    }
+    return cache;
+}
+
+void ssl_cert_msg_cache_free(SSL_CERT_MSG_CACHE *cache)
+{
+    size_t j;
+    int i;
+
+    if (cache == NULL)
+        return;
+    CRYPTO_DOWN_REF(&cache->references, &i, cache->lock);
+    if (i > 0)
+        return;
+    REF_ASSERT_ISNT(i < 0);
+
+    ssl_cert_msg_free(cache->msg);
+    for (j = 0; j < OSSL_NELEM(cache->comp); j++)
+        ssl_cert_comp_free(cache->comp[j]);
+    CRYPTO_THREAD_lock_free(cache->lock);
+    OPENSSL_free(cache);
+}
+
+/*
+ * Give |cpk| a cache of its own once its certificate or chain changes, so
+ * that it no longer replaces the message cached for the CERT it was copied
+ * from, and vice versa. Without a cache every handshake encodes the message.
+ */
+void ssl_cert_msg_cache_reset(CERT_PKEY *cpk)
+{
+    ssl_cert_msg_cache_free(cpk->msgcache);
+    cpk->msgcache = ssl_cert_msg_cache_new();
+}
+
+void ssl_cert_comp_free(SSL_CERT_COMP *comp)
+{
+    if (comp == NULL)
+        return;
+    OPENSSL_free(comp->orig);
+    OPENSSL_free(comp->data);
+    OPENSSL_free(comp);
+}
+
+const SSL_CERT_COMP_METHOD *ssl_cert_comp_method(const SSL_CTX *ctx,
+                                                 unsigned int alg)
+{
+    size_t i;
+
+    for (i = 0; i < ctx->ext.cert_comp_meths_len; i++) {
+        if (ctx->ext.cert_comp_meths[i].alg == alg)
+            return &ctx->ext.cert_comp_meths[i];
+    }
+    return NULL;
+}
+
+/*
+ * Encode the certificate list of a Certificate message for |certs|, the leaf
+ * followed by its chain. The new message takes its own references.
+ */
+SSL_CERT_MSG *ssl_cert_msg_new(STACK_OF(X509) *certs, X509_STORE *store,
+                               unsigned long generation)
+{
+    SSL_CERT_MSG *msg = OPENSSL_zalloc(sizeof(*msg));
+    unsigned char *p;
+    size_t len = 0;
+    int i, l;
+
+    if (msg == NULL)
+        return NULL;
+    msg->references = 1;
+    if ((msg->lock = CRYPTO_THREAD_lock_new()) == NULL) {
+        OPENSSL_free(msg);
+        return NULL;
+    }
+    msg->num = sk_X509_num(certs);
+    if ((msg->certs = X509_chain_up_ref(certs)) == NULL
+            || (msg->offs = OPENSSL_malloc(sizeof(*msg->offs)
+                                           * (msg->num + 1))) == NULL)
+        goto err;
+    for (i = 0; i < msg->num; i++) {
+        if ((l = i2d_X509(sk_X509_value(certs, i), NULL)) <= 0)
+            goto err;
+        msg->offs[i] = len;
+        len += 3 + l;
+    }
+    msg->offs[msg->num] = len;
+    if ((msg->data = OPENSSL_malloc(len > 0 ? len : 1)) == NULL)
+        goto err;
+    for (i = 0; i < msg->num; i++) {
+        p = msg->data + msg->offs[i];
+        l = (int)(msg->offs[i + 1] - msg->offs[i] - 3);
+        l2n3(l, p);
+        if (i2d_X509(sk_X509_value(certs, i), &p) != l)
+            goto err;
+    }
+    if (store != NULL) {
+        if (!X509_STORE_up_ref(store))
+            goto err;
+        msg->store = store;
+        msg->generation = generation;
+    }
+    return msg;
+
+ err:
+    ssl_cert_msg_free(msg);
+    return NULL;
+}
+
+int ssl_cert_msg_up_ref(SSL_CERT_MSG *msg)
+{
+    int i;
+
+    if (CRYPTO_UP_REF(&msg->references, &i, msg->lock) <= 0)
+        return 0;
+
+    REF_ASSERT_ISNT(i < 2);
+    return ((i > 1) ? 1 : 0);
+}
+
+void ssl_cert_msg_free(SSL_CERT_MSG *msg)
+{
+    int i;
+
+    if (msg == NULL)
+        return;
+    CRYPTO_DOWN_REF(&msg->references, &i, msg->lock);
+    if (i > 0)
+        return;
+    REF_ASSERT_ISNT(i < 0);
+
+    sk_X509_pop_free(msg->certs, X509_free);
+    X509_STORE_free(msg->store);
+    OPENSSL_free(msg->data);
+    OPENSSL_free(msg->offs);
+    CRYPTO_THREAD_lock_free(msg->lock);
+    OPENSSL_free(msg);
+}
+
 CERT *ssl_cert_new(void)
 {
     CERT *ret = OPENSSL_zalloc(sizeof(*ret));
+    int i;
 
     if (ret == NULL) {
         SSLerr(SSL_F_SSL_CERT_NEW, ERR_R_MALLOC_FAILURE);
@@ -67,6 +216,9 @@ CERT *ssl_cert_new(void)
         OPENSSL_free(ret);
         return NULL;
     }
+    /* Shared with every copy, see ssl_cert_dup() */
+    for (i = 0; i < SSL_PKEY_NUM; i++)
+        ret->pkeys[i].msgcache = ssl_cert_msg_cache_new();
 
     return ret;
 }
@@ -74,7 +226,7 @@ CERT *ssl_cert_new(void)
 CERT *ssl_cert_dup(CERT *cert)
 {
     CERT *ret = OPENSSL_zalloc(sizeof(*ret));
-    int i;
+    int i, ref;
 
     if (ret == NULL) {
         SSLerr(SSL_F_SSL_CERT_DUP, ERR_R_MALLOC_FAILURE);
@@ -118,6 +270,12 @@ CERT *ssl_cert_dup(CERT *cert)
                 goto err;
             }
         }
+
+        if (cpk->msgcache != NULL) {
+            CRYPTO_UP_REF(&cpk->msgcache->references, &ref,
+                          cpk->msgcache->lock);
+            rpk->msgcache = cpk->msgcache;
+        }
         if (cert->pkeys[i].serverinfo != NULL) {
             /* Just copy everything. */
             ret->pkeys[i].serverinfo =
@@ -236,6 +394,8 @@ void ssl_cert_free(CERT *c)
 #endif
 
     ssl_cert_clear_certs(c);
+    for (i = 0; i < SSL_PKEY_NUM; i++)
+        ssl_cert_msg_cache_free(c->pkeys[i].msgcache);
     OPENSSL_free(c->conf_sigalgs);
     OPENSSL_free(c->client_sigalgs);
     OPENSSL_free(c->ctype);
@@ -264,6 +424,7 @@ int ssl_cert_set0_chain(SSL *s, SSL_CTX *ctx, STACK_OF(X509) *chain)
     }
     sk_X509_pop_free(cpk->chain, X509_free);
     cpk->chain = chain;
+    ssl_cert_msg_cache_reset(cpk);
     return 1;
 }
 
@@ -297,6 +458,7 @@ int ssl_cert_add0_chain_cert(SSL *s, SSL_CTX *ctx, X509 *x)
         cpk->chain = sk_X509_new_null();
     if (!cpk->chain || !sk_X509_push(cpk->chain, x))
         return 0;
+    ssl_cert_msg_cache_reset(cpk);
     return 1;
 }
 
@@ -880,6 +1042,7 @@ int ssl_build_cert_chain(SSL *s, SSL_CTX *ctx, int flags)
     }
     sk_X509_pop_free(cpk->chain, X509_free);
     cpk->chain = chain;
+    ssl_cert_msg_cache_reset(cpk);
     if (rv == 0)
         rv = 1;
  err:
@@ -22,6 +22,11 @@
 #include <openssl/ct.h>
 #include "internal/cryptlib.h"
 #include "internal/refcount.h"
+#include "internal/ktls.h"
+#include "internal/sslcomp.h"
+#ifdef OPENSSL_SYS_UNIX
+# include <unistd.h>
+#endif
 
 const char SSL_version_str[] = OPENSSL_VERSION_TEXT;
 
@@ -614,6 +619,8 @@ int SSL_clear(SSL *s)
     s->first_packet = 0;
 
     s->key_update = SSL_KEY_UPDATE_NONE;
+    s->dynrec.sent = 0;
+    s->writev_done = 0;
 
     EVP_MD_CTX_free(s->pha_dgst);
     s->pha_dgst = NULL;
@@ -758,6 +765,9 @@ SSL *SSL_new(SSL_CTX *ctx)
     s->max_pipelines = ctx->max_pipelines;
     if (s->max_pipelines > 1)
         RECORD_LAYER_set_read_ahead(&s->rlayer, 1);
+    s->dynrec.initial_size = ctx->dynrec.initial_size;
+    s->dynrec.ramp_bytes = ctx->dynrec.ramp_bytes;
+    s->dynrec.idle_timeout = ctx->dynrec.idle_timeout;
     if (ctx->default_read_buf_len > 0)
         SSL_set_default_read_buffer_len(s, ctx->default_read_buf_len);
 
@@ -774,6 +784,12 @@ SSL *SSL_new(SSL_CTX *ctx)
     s->ext.ocsp.resp_len = 0;
     SSL_CTX_up_ref(ctx);
     s->session_ctx = ctx;
+    /*
+     * The session cache mode and the buffer pool can no longer change shape,
+     * see SSL_CTX_ctrl() and ssl3_buffer_pool_set_size()
+     */
+    if (!tsan_load(&ctx->in_use))
+        tsan_store(&ctx->in_use, 1);
 #ifndef OPENSSL_NO_EC
     if (ctx->ext.ecpointformats) {
         s->ext.ecpointformats =
@@ -932,9 +948,7 @@ int SSL_has_matching_session_id(const SSL *ssl, const unsigned char *id,
     r.session_id_length = id_len;
     memcpy(r.session_id, id, id_len);
 
-    CRYPTO_THREAD_read_lock(ssl->session_ctx->lock);
-    p = lh_SSL_SESSION_retrieve(ssl->session_ctx->sessions, &r);
-    CRYPTO_THREAD_unlock(ssl->session_ctx->lock);
+    p = ssl_session_cache_find(ssl->session_ctx, &r, 0);
     return (p != NULL);
 }
 
@@ -1201,6 +1215,7 @@ void SSL_free(SSL *s)
     OPENSSL_free(s->ext.alpn);
     OPENSSL_free(s->ext.tls13_cookie);
     OPENSSL_free(s->clienthello);
+    OPENSSL_free(s->writev_buf);
     OPENSSL_free(s->pha_context);
     EVP_MD_CTX_free(s->pha_dgst);
 
@@ -1511,6 +1526,14 @@ int SSL_has_pending(const SSL *s)
     if (RECORD_LAYER_processed_read_pending(&s->rlayer))
         return 1;
 
+    /*
+     * A datagram BIO in batch mode may already have received datagrams that
+     * a select() on its socket won't report any more
+     */
+    if (SSL_IS_DTLS(s) && s->rbio != NULL && BIO_dgram_get_batch(s->rbio) > 1
+            && BIO_pending(s->rbio) > 0)
+        return 1;
+
     return RECORD_LAYER_read_pending(&s->rlayer);
 }
 
@@ -1793,6 +1816,41 @@ int SSL_read_ex(SSL *s, void *buf, size_t num, size_t *readbytes)
     return ret;
 }
 
+/*
+ * Read into |iovcnt| buffers in turn. Like SSL_read_ex() this only waits for
+ * the first bytes, after that it just takes what is already pending.
+ */
+int SSL_readv(SSL *s, const SSL_IOVEC *iov, size_t iovcnt, size_t *readbytes)
+{
+    size_t total = 0, i, off = 0, tmpread;
+
+    for (i = 0; i < iovcnt && iov[i].iov_len == 0; i++)
+        continue;
+    if (i == iovcnt)
+        return SSL_read_ex(s, NULL, 0, readbytes);
+
+    while (i < iovcnt) {
+        if (off == iov[i].iov_len) {
+            i++;
+            off = 0;
+            continue;
+        }
+        if (total > 0 && SSL_pending(s) == 0)
+            break;
+        if (!SSL_read_ex(s, (unsigned char *)iov[i].iov_base + off,
+                         iov[i].iov_len - off, &tmpread)) {
+            if (total > 0)
+                break;
+            return 0;
+        }
+        off += tmpread;
+        total += tmpread;
+    }
+
+    *readbytes = total;
+    return 1;
+}
+
 int SSL_read_early_data(SSL *s, void *buf, size_t num, size_t *readbytes)
 {
     int ret;
@@ -1953,6 +2011,73 @@ int ssl_write_internal(SSL *s, const void *buf, size_t num, size_t *written)
     }
 }
 
+#ifndef OPENSSL_NO_KTLS
+ossl_ssize_t SSL_sendfile(SSL *s, int fd, off_t offset, size_t size, int flags)
+{
+    ossl_ssize_t ret;
+
+    if (s->handshake_func == NULL) {
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_UNINITIALIZED);
+        return -1;
+    }
+
+    if (s->shutdown & SSL_SENT_SHUTDOWN) {
+        s->rwstate = SSL_NOTHING;
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_PROTOCOL_IS_SHUTDOWN);
+        return -1;
+    }
+
+    /* The kernel must do the encryption for the data never to reach us */
+    if (!BIO_get_ktls_send(s->wbio)) {
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_KTLS_SEND_NOT_ENABLED);
+        return -1;
+    }
+
+    /* Data from an earlier SSL_write() must go out first */
+    if (RECORD_LAYER_write_pending(&s->rlayer)) {
+        SSLerr(SSL_F_SSL_SENDFILE, SSL_R_BAD_WRITE_RETRY);
+        return -1;
+    }
+
+    /* If we have an alert to send, lets send it */
+    if (s->s3->alert_dispatch) {
+        ret = (ossl_ssize_t)s->method->ssl_dispatch_alert(s);
+        if (ret <= 0) {
+            /* SSLfatal() already called if appropriate */
+            return ret;
+        }
+        /* if it went, fall through and send more stuff */
+    }
+
+    s->rwstate = SSL_WRITING;
+    if (BIO_flush(s->wbio) <= 0) {
+        if (!BIO_should_retry(s->wbio)) {
+            s->rwstate = SSL_NOTHING;
+        } else {
+#ifdef EAGAIN
+            set_sys_error(EAGAIN);
+#endif
+        }
+        return -1;
+    }
+
+    ret = ktls_sendfile(SSL_get_wfd(s), fd, offset, size, flags);
+    if (ret < 0) {
+        int err = get_last_sys_error();
+
+        if (err == EAGAIN || err == EINTR || err == EBUSY) {
+            BIO_set_retry_write(s->wbio);
+        } else {
+            SYSerr(SYS_F_SENDFILE, err);
+            SSLerr(SSL_F_SSL_SENDFILE, ERR_R_SYS_LIB);
+        }
+        return ret;
+    }
+    s->rwstate = SSL_NOTHING;
+    return ret;
+}
+#endif
+
 int SSL_write(SSL *s, const void *buf, int num)
 {
     int ret;
@@ -1984,6 +2109,100 @@ int SSL_write_ex(SSL *s, const void *buf, size_t num, size_t *written)
     return ret;
 }
 
+/*
+ * Whether an SSL_writev() of |total| bytes repeats the one that stopped after
+ * s->writev_done bytes: it is for as many bytes and no other I/O call on |s|
+ * has completed since. A record that is still waiting to be written out is
+ * always the one the stopped call started.
+ */
+static int ssl_writev_is_retry(const SSL *s, size_t total)
+{
+    return s->writev_done != 0 && s->writev_total == total
+        && (s->rwstate != SSL_NOTHING
+            || RECORD_LAYER_write_pending(&s->rlayer));
+}
+
+/*
+ * Write the data in |iovcnt| buffers as if it was one buffer. Whole records
+ * that lie within one buffer are written straight from it, the records that
+ * span buffers are gathered into |s->writev_buf| first. A call that has to be
+ * repeated picks up where it left off, so the buffers must not change in
+ * between.
+ */
+int SSL_writev(SSL *s, const SSL_IOVEC *iov, size_t iovcnt, size_t *written)
+{
+    size_t total = 0, done, max, i, off, len, n, tmpwrit;
+    const unsigned char *buf;
+    int ret;
+
+    for (i = 0; i < iovcnt; i++) {
+        if (iov[i].iov_len > SIZE_MAX - total) {
+            SSLerr(SSL_F_SSL_WRITEV, SSL_R_BAD_LENGTH);
+            return 0;
+        }
+        total += iov[i].iov_len;
+    }
+    if (total == 0)
+        return SSL_write_ex(s, NULL, 0, written);
+
+    max = ssl_get_max_send_fragment(s);
+    done = ssl_writev_is_retry(s, total) ? s->writev_done : 0;
+    s->writev_done = 0;
+    while (done < total) {
+        /* Find the buffer holding the next byte to send */
+        for (i = 0, off = done; off >= iov[i].iov_len; i++)
+            off -= iov[i].iov_len;
+        len = iov[i].iov_len - off;
+
+        if (len >= max || done + len == total) {
+            buf = (const unsigned char *)iov[i].iov_base + off;
+            if (done + len != total)
+                len -= len % max;
+        } else {
+            len = total - done < max ? total - done : max;
+            if (s->writev_buf_len < max) {
+                OPENSSL_free(s->writev_buf);
+                s->writev_buf_len = 0;
+                if ((s->writev_buf = OPENSSL_malloc(max)) == NULL) {
+                    SSLerr(SSL_F_SSL_WRITEV, ERR_R_MALLOC_FAILURE);
+                    return 0;
+                }
+                s->writev_buf_len = max;
+            }
+            for (n = 0; n < len; i++, off = 0) {
+                size_t chunk = iov[i].iov_len - off;
+
+                if (chunk > len - n)
+                    chunk = len - n;
+                memcpy(s->writev_buf + n,
+                       (const unsigned char *)iov[i].iov_base + off, chunk);
+                n += chunk;
+            }
+            buf = s->writev_buf;
+        }
+
+        ret = ssl_write_internal(s, buf, len, &tmpwrit);
+        if (ret <= 0) {
+            /*
+             * A partial write can report what was sent so far, unless a
+             * record of the current piece is still waiting to be written
+             * out: only a repeated call with the same data can finish it.
+             */
+            if ((s->mode & SSL_MODE_ENABLE_PARTIAL_WRITE) != 0 && done > 0
+                    && !RECORD_LAYER_write_pending(&s->rlayer)
+                    && s->rlayer.wnum == 0)
+                break;
+            s->writev_done = done;
+            s->writev_total = total;
+            return 0;
+        }
+        done += tmpwrit;
+    }
+
+    *written = done;
+    return 1;
+}
+
 int SSL_write_early_data(SSL *s, const void *buf, size_t num, size_t *written)
 {
     int ret, early_data_state;
@@ -2213,6 +2432,10 @@ long SSL_ctrl(SSL *s, int cmd, long larg, void *parg)
         if (larg > 1)
             RECORD_LAYER_set_read_ahead(&s->rlayer, 1);
         return 1;
+    case SSL_CTRL_GET_DYNAMIC_RECORD_SMALL:
+        return (long)s->dynrec.small_records;
+    case SSL_CTRL_GET_DYNAMIC_RECORD_RESETS:
+        return (long)s->dynrec.resets;
     case SSL_CTRL_GET_RI_SUPPORT:
         if (s->s3)
             return s->s3->send_connection_binding;
@@ -2325,13 +2548,33 @@ long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
         return (long)ctx->session_cache_size;
     case SSL_CTRL_SET_SESS_CACHE_MODE:
         l = ctx->session_cache_mode;
+        if (((l ^ larg) & SSL_SESS_CACHE_SHARDED) != 0) {
+            /*
+             * Once SSL objects use the cache it is accessed without a lock
+             * that would let it change shape, so the mode can't change.
+             */
+            if (tsan_load(&ctx->in_use)) {
+                SSLerr(SSL_F_SSL_CTX_CTRL, SSL_R_SESSION_CACHE_IN_USE);
+                return 0;
+            }
+            if ((larg & SSL_SESS_CACHE_SHARDED) != 0
+                    && ctx->session_shards == NULL
+                    && !ssl_session_shards_new(ctx))
+                return 0;
+            /*
+             * Sessions are not moved between the sharded and the unsharded
+             * cache, so drop whatever is cached when switching.
+             */
+            SSL_CTX_flush_sessions(ctx, 0);
+            ctx->session_cache_sharded = (larg & SSL_SESS_CACHE_SHARDED) != 0;
+        }
         ctx->session_cache_mode = larg;
         return l;
     case SSL_CTRL_GET_SESS_CACHE_MODE:
         return ctx->session_cache_mode;
 
     case SSL_CTRL_SESS_NUMBER:
-        return lh_SSL_SESSION_num_items(ctx->sessions);
+        return (long)ssl_session_cache_num(ctx);
     case SSL_CTRL_SESS_CONNECT:
         return tsan_load(&ctx->stats.sess_connect);
     case SSL_CTRL_SESS_CONNECT_GOOD:
@@ -2354,6 +2597,18 @@ long SSL_CTX_ctrl(SSL_CTX *ctx, int cmd, long larg, void *parg)
         return tsan_load(&ctx->stats.sess_timeout);
     case SSL_CTRL_SESS_CACHE_FULL:
         return tsan_load(&ctx->stats.sess_cache_full);
+    case SSL_CTRL_SET_BUFFER_POOL_SIZE:
+        if (larg < 0)
+            return 0;
+        return ssl3_buffer_pool_set_size(ctx, (size_t)larg);
+    case SSL_CTRL_GET_BUFFER_POOL_SIZE:
+        return (long)ssl3_buffer_pool_get_size(ctx);
+    case SSL_CTRL_BUFFER_POOL_HITS:
+        return (long)ssl3_buffer_pool_hits(ctx);
+    case SSL_CTRL_BUFFER_POOL_MISSES:
+        return (long)ssl3_buffer_pool_misses(ctx);
+    case SSL_CTRL_BUFFER_POOL_BYTES:
+        return (long)ssl3_buffer_pool_bytes(ctx);
     case SSL_CTRL_MODE:
         return (ctx->mode |= larg);
     case SSL_CTRL_CLEAR_MODE:
@@ -2836,6 +3091,324 @@ void SSL_get0_alpn_selected(const SSL *ssl, const unsigned char **data,
         *len = (unsigned int)ssl->s3->alpn_selected_len;
 }
 
+#ifndef OPENSSL_NO_COMP
+static int ssl_cert_compress_zlib(SSL *s, const unsigned char *in,
+                                  size_t inlen, unsigned char *out,
+                                  size_t *outlen)
+{
+    COMP_CTX *comp;
+    int ret;
+
+    if (inlen > INT_MAX || *outlen > INT_MAX
+            || (comp = COMP_CTX_new(COMP_zlib_oneshot())) == NULL)
+        return 0;
+    ret = COMP_compress_block(comp, out, (int)*outlen, (unsigned char *)in,
+                              (int)inlen);
+    COMP_CTX_free(comp);
+    if (ret <= 0)
+        return 0;
+    *outlen = ret;
+    return 1;
+}
+
+static int ssl_cert_decompress_zlib(SSL *s, const unsigned char *in,
+                                    size_t inlen, unsigned char *out,
+                                    size_t outlen)
+{
+    COMP_CTX *comp;
+    int ret;
+
+    if (inlen > INT_MAX || outlen > INT_MAX
+            || (comp = COMP_CTX_new(COMP_zlib_oneshot())) == NULL)
+        return 0;
+    ret = COMP_expand_block(comp, out, (int)outlen, (unsigned char *)in,
+                            (int)inlen);
+    COMP_CTX_free(comp);
+    return ret >= 0 && (size_t)ret == outlen;
+}
+#endif
+
+/*
+ * Add |alg| to the certificate compression algorithms of |ctx|, after any
+ * added before. A client offers the algorithms it can decompress, and a
+ * server compresses its Certificate message with the first one it can
+ * compress that the client offered. If both callbacks are NULL the built-in
+ * implementation of |alg| is used, which is only available for zlib.
+ */
+int SSL_CTX_add_cert_compression_alg(SSL_CTX *ctx, int alg,
+                                     SSL_cert_compress_cb_fn compress,
+                                     SSL_cert_decompress_cb_fn decompress)
+{
+    SSL_CERT_COMP_METHOD *meth;
+
+    if (alg <= 0 || alg > 0xffff) {
+        SSLerr(SSL_F_SSL_CTX_ADD_CERT_COMPRESSION_ALG,
+               SSL_R_INVALID_COMPRESSION_ALGORITHM);
+        return 0;
+    }
+    if (ssl_cert_comp_method(ctx, alg) != NULL) {
+        SSLerr(SSL_F_SSL_CTX_ADD_CERT_COMPRESSION_ALG,
+               SSL_R_DUPLICATE_COMPRESSION_ID);
+        return 0;
+    }
+    if (ctx->ext.cert_comp_meths_len == OSSL_NELEM(ctx->ext.cert_comp_meths)) {
+        SSLerr(SSL_F_SSL_CTX_ADD_CERT_COMPRESSION_ALG,
+               SSL_R_TOO_MANY_CERT_COMPRESSION_ALGORITHMS);
+        return 0;
+    }
+    if (compress == NULL && decompress == NULL) {
+#ifndef OPENSSL_NO_COMP
+        if (alg == TLSEXT_comp_cert_zlib
+                && COMP_get_type(COMP_zlib_oneshot()) != NID_undef) {
+            compress = ssl_cert_compress_zlib;
+            decompress = ssl_cert_decompress_zlib;
+        }
+#endif
+        if (compress == NULL) {
+            SSLerr(SSL_F_SSL_CTX_ADD_CERT_COMPRESSION_ALG,
+                   SSL_R_UNSUPPORTED_COMPRESSION_ALGORITHM);
+            return 0;
+        }
+    }
+
+    meth = &ctx->ext.cert_comp_meths[ctx->ext.cert_comp_meths_len++];
+    meth->alg = (uint16_t)alg;
+    meth->compress = compress;
+    meth->decompress = decompress;
+
+    return 1;
+}
+
+/* The process the ephemeral key pools belong to. Without fork() there's one */
+#ifdef OPENSSL_SYS_UNIX
+# define eph_key_pool_pid()      ((long)getpid())
+#else
+# define eph_key_pool_pid()      0L
+#endif
+
+void ssl_ctx_eph_key_pools_free(SSL_CTX *ctx)
+{
+    size_t i, j;
+
+    for (i = 0; i < ctx->eph_pools_len; i++) {
+        SSL_EPH_KEY_POOL *pool = &ctx->eph_pools[i];
+
+        for (j = 0; j < pool->num; j++)
+            EVP_PKEY_free(pool->keys[j]);
+        OPENSSL_free(pool->keys);
+    }
+    OPENSSL_free(ctx->eph_pools);
+    ctx->eph_pools = NULL;
+    ctx->eph_pools_len = 0;
+    ctx->eph_pool_gen++;
+}
+
+int SSL_CTX_set_ephemeral_key_pool(SSL_CTX *ctx, size_t depth)
+{
+    if (depth > SSL_MAX_EPHEMERAL_KEY_POOL) {
+        SSLerr(SSL_F_SSL_CTX_SET_EPHEMERAL_KEY_POOL, SSL_R_BAD_VALUE);
+        return 0;
+    }
+    CRYPTO_THREAD_write_lock(ctx->eph_pool_lock);
+    ssl_ctx_eph_key_pools_free(ctx);
+    ctx->eph_pool_pid = eph_key_pool_pid();
+    tsan_store(&ctx->eph_pool_depth, depth);
+    CRYPTO_THREAD_unlock(ctx->eph_pool_lock);
+    return 1;
+}
+
+size_t SSL_CTX_get_ephemeral_key_pool(const SSL_CTX *ctx)
+{
+    return tsan_load(&ctx->eph_pool_depth);
+}
+
+#ifndef OPENSSL_NO_EC
+/*
+ * Drop the pools if they were filled by another process, so that children
+ * forked after the pools were filled don't all hand out the same keys. Call
+ * with |eph_pool_lock|.
+ */
+static void eph_key_pools_check_fork(SSL_CTX *ctx)
+{
+    long pid = eph_key_pool_pid();
+
+    if (ctx->eph_pool_pid != pid) {
+        ssl_ctx_eph_key_pools_free(ctx);
+        ctx->eph_pool_pid = pid;
+    }
+}
+
+/*
+ * Find the pool for |id|, creating it if |create| is set. Call with
+ * |eph_pool_lock| and a non-zero depth.
+ */
+static SSL_EPH_KEY_POOL *eph_key_pool(SSL_CTX *ctx, uint16_t id, int create)
+{
+    SSL_EPH_KEY_POOL *pools, *pool;
+    size_t i;
+
+    for (i = 0; i < ctx->eph_pools_len; i++) {
+        if (ctx->eph_pools[i].group_id == id)
+            return &ctx->eph_pools[i];
+    }
+    if (!create)
+        return NULL;
+
+    pools = OPENSSL_realloc(ctx->eph_pools,
+                            (ctx->eph_pools_len + 1) * sizeof(*pools));
+    if (pools == NULL)
+        return NULL;
+    ctx->eph_pools = pools;
+    pool = &pools[ctx->eph_pools_len];
+    pool->keys = OPENSSL_malloc(ctx->eph_pool_depth * sizeof(*pool->keys));
+    if (pool->keys == NULL)
+        return NULL;
+    pool->group_id = id;
+    pool->num = 0;
+    pool->filling = 0;
+    ctx->eph_pools_len++;
+    return pool;
+}
+
+/*
+ * Generate |n| keys, at most one batch and one more, for the pool |id| of
+ * generation |gen|. If |out| is not NULL the first key goes to the caller.
+ * The keys are generated without holding the lock, and any that the pool
+ * has no room for by then, or that were made for pools since dropped, are
+ * freed. Clear the pool's |filling| flag if |filled| is set. Returns 1 if all
+ * |n| keys were generated or 0 otherwise.
+ */
+static int eph_key_pool_batch(SSL_CTX *ctx, uint16_t id, unsigned int gen,
+                              size_t n, EVP_PKEY **out, int filled)
+{
+    SSL_EPH_KEY_POOL *pool;
+    EVP_PKEY *keys[SSL_EPH_KEY_POOL_BATCH + 1];
+    size_t got, i = 0;
+
+    got = ssl_generate_pkey_group_batch(id, keys, n);
+    if (out != NULL && got > 0)
+        *out = keys[i++];
+
+    CRYPTO_THREAD_write_lock(ctx->eph_pool_lock);
+    eph_key_pools_check_fork(ctx);
+    if (ctx->eph_pool_gen == gen
+            && (pool = eph_key_pool(ctx, id, 0)) != NULL) {
+        while (i < got && pool->num < ctx->eph_pool_depth)
+            pool->keys[pool->num++] = keys[i++];
+        if (filled)
+            pool->filling = 0;
+    }
+    CRYPTO_THREAD_unlock(ctx->eph_pool_lock);
+
+    for (; i < got; i++)
+        EVP_PKEY_free(keys[i]);
+    return got == n;
+}
+
+/*
+ * Take a key for the group |id| out of the pool. The first handshake to find
+ * the pool empty refills it with one batch of keys and takes the first of
+ * them, any other handshake meanwhile gets NULL. Returns NULL if the pool is
+ * disabled or empty, in which case the caller should generate a key itself.
+ */
+EVP_PKEY *ssl_ctx_eph_key_pool_get(SSL_CTX *ctx, uint16_t id)
+{
+    SSL_EPH_KEY_POOL *pool;
+    EVP_PKEY *pkey = NULL;
+    unsigned int gen;
+    size_t n = 0;
+
+    if (tsan_load(&ctx->eph_pool_depth) == 0)
+        return NULL;
+
+    CRYPTO_THREAD_write_lock(ctx->eph_pool_lock);
+    eph_key_pools_check_fork(ctx);
+    if (ctx->eph_pool_depth > 0
+            && (pool = eph_key_pool(ctx, id, 1)) != NULL) {
+        if (pool->num > 0) {
+            pkey = pool->keys[--pool->num];
+            pool->keys[pool->num] = NULL;
+        } else if (!pool->filling) {
+            pool->filling = 1;
+            n = ctx->eph_pool_depth;
+            if (n > SSL_EPH_KEY_POOL_BATCH)
+                n = SSL_EPH_KEY_POOL_BATCH;
+        }
+    }
+    gen = ctx->eph_pool_gen;
+    CRYPTO_THREAD_unlock(ctx->eph_pool_lock);
+
+    if (n > 0) {
+        ERR_set_mark();
+        eph_key_pool_batch(ctx, id, gen, n + 1, &pkey, 1);
+        ERR_pop_to_mark();
+    }
+    return pkey;
+}
+#endif
+
+int SSL_CTX_fill_ephemeral_key_pool(SSL_CTX *ctx, int nid)
+{
+#ifndef OPENSSL_NO_EC
+    uint16_t id = tls1_nid2group_id(nid);
+    SSL_EPH_KEY_POOL *pool;
+    unsigned int gen;
+    size_t depth, n, need = SSL_MAX_EPHEMERAL_KEY_POOL;
+    int filled;
+
+    if (id == 0) {
+        SSLerr(SSL_F_SSL_CTX_FILL_EPHEMERAL_KEY_POOL,
+               SSL_R_UNSUPPORTED_ELLIPTIC_CURVE);
+        return 0;
+    }
+
+    /*
+     * Top the pool up one batch at a time, so that handshakes can take keys
+     * in between. Generate no more keys in all than the pool was short of at
+     * the start, even if handshakes keep taking them.
+     */
+    for (;;) {
+        n = 0;
+        filled = 0;
+        CRYPTO_THREAD_write_lock(ctx->eph_pool_lock);
+        eph_key_pools_check_fork(ctx);
+        depth = ctx->eph_pool_depth;
+        pool = depth > 0 ? eph_key_pool(ctx, id, 1) : NULL;
+        if (pool != NULL) {
+            if (need > depth - pool->num)
+                need = depth - pool->num;
+            n = need < SSL_EPH_KEY_POOL_BATCH ? need : SSL_EPH_KEY_POOL_BATCH;
+            if (n > 0 && !pool->filling)
+                pool->filling = filled = 1;
+        }
+        gen = ctx->eph_pool_gen;
+        CRYPTO_THREAD_unlock(ctx->eph_pool_lock);
+
+        if (depth == 0) {
+            SSLerr(SSL_F_SSL_CTX_FILL_EPHEMERAL_KEY_POOL,
+                   SSL_R_EPHEMERAL_KEY_POOL_DISABLED);
+            return 0;
+        }
+        if (pool == NULL) {
+            SSLerr(SSL_F_SSL_CTX_FILL_EPHEMERAL_KEY_POOL,
+                   ERR_R_MALLOC_FAILURE);
+            return 0;
+        }
+        if (n == 0)
+            return 1;
+        if (!eph_key_pool_batch(ctx, id, gen, n, NULL, filled)) {
+            SSLerr(SSL_F_SSL_CTX_FILL_EPHEMERAL_KEY_POOL, ERR_R_EVP_LIB);
+            return 0;
+        }
+        need -= n;
+    }
+#else
+    SSLerr(SSL_F_SSL_CTX_FILL_EPHEMERAL_KEY_POOL,
+           SSL_R_UNSUPPORTED_ELLIPTIC_CURVE);
+    return 0;
+#endif
+}
+
 int SSL_export_keying_material(SSL *s, unsigned char *out, size_t olen,
                                const char *label, size_t llen,
                                const unsigned char *context, size_t contextlen,
@@ -2897,6 +3470,46 @@ static int ssl_session_cmp(const SSL_SESSION *a, const SSL_SESSION *b)
     return memcmp(a->session_id, b->session_id, a->session_id_length);
 }
 
+int ssl_session_shards_new(SSL_CTX *ctx)
+{
+    SSL_SESSION_SHARD *shards;
+    size_t i;
+
+    shards = OPENSSL_zalloc(sizeof(*shards) * SSL_SESSION_CACHE_SHARDS);
+    if (shards == NULL)
+        goto err;
+    ctx->session_shards = shards;
+
+    for (i = 0; i < SSL_SESSION_CACHE_SHARDS; i++) {
+        shards[i].lock = CRYPTO_THREAD_lock_new();
+        shards[i].sessions = lh_SSL_SESSION_new(ssl_session_hash,
+                                                ssl_session_cmp);
+        if (shards[i].lock == NULL || shards[i].sessions == NULL)
+            goto err;
+    }
+    return 1;
+
+ err:
+    ssl_session_shards_free(ctx);
+    SSLerr(SSL_F_SSL_SESSION_SHARDS_NEW, ERR_R_MALLOC_FAILURE);
+    return 0;
+}
+
+void ssl_session_shards_free(SSL_CTX *ctx)
+{
+    size_t i;
+
+    if (ctx->session_shards == NULL)
+        return;
+
+    for (i = 0; i < SSL_SESSION_CACHE_SHARDS; i++) {
+        lh_SSL_SESSION_free(ctx->session_shards[i].sessions);
+        CRYPTO_THREAD_lock_free(ctx->session_shards[i].lock);
+    }
+    OPENSSL_free(ctx->session_shards);
+    ctx->session_shards = NULL;
+}
+
 /*
  * These wrapper functions should remain rather than redeclaring
  * SSL_SESSION_hash and SSL_SESSION_cmp for void* types and casting each
@@ -2939,6 +3552,12 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
         OPENSSL_free(ret);
         return NULL;
     }
+    if ((ret->eph_pool_lock = CRYPTO_THREAD_lock_new()) == NULL) {
+        SSLerr(SSL_F_SSL_CTX_NEW, ERR_R_MALLOC_FAILURE);
+        CRYPTO_THREAD_lock_free(ret->lock);
+        OPENSSL_free(ret);
+        return NULL;
+    }
     ret->max_cert_list = SSL_MAX_CERT_LIST_DEFAULT;
     ret->verify_mode = SSL_VERIFY_NONE;
     if ((ret->cert = ssl_cert_new()) == NULL)
@@ -3001,12 +3620,9 @@ SSL_CTX *SSL_CTX_new(const SSL_METHOD *meth)
     ret->split_send_fragment = SSL3_RT_MAX_PLAIN_LENGTH;
 
     /* Setup RFC5077 ticket keys */
-    if ((RAND_bytes(ret->ext.tick_key_name,
-                    sizeof(ret->ext.tick_key_name)) <= 0)
-        || (RAND_priv_bytes(ret->ext.secure->tick_hmac_key,
-                       sizeof(ret->ext.secure->tick_hmac_key)) <= 0)
-        || (RAND_priv_bytes(ret->ext.secure->tick_aes_key,
-                       sizeof(ret->ext.secure->tick_aes_key)) <= 0))
+    if ((ret->ext.tick_keys_lock = CRYPTO_THREAD_lock_new()) == NULL)
+        goto err;
+    if (!tls1_new_ticket_key(ret))
         ret->options |= SSL_OP_NO_TICKET;
 
     if (RAND_priv_bytes(ret->ext.cookie_hmac_key,
@@ -3129,12 +3745,17 @@ void SSL_CTX_free(SSL_CTX *a)
      * the most secure solution seems to be: empty (flush) the cache, then
      * free ex_data, then finally free the cache.
      * (See ticket [openssl.org #212].)
+     * Sessions in a shared session cache outlive this SSL_CTX, so detach
+     * from it first.
      */
+    ssl_shm_sess_cache_free(a);
     if (a->sessions != NULL)
         SSL_CTX_flush_sessions(a, 0);
 
     CRYPTO_free_ex_data(CRYPTO_EX_INDEX_SSL_CTX, a, &a->ex_data);
     lh_SSL_SESSION_free(a->sessions);
+    ssl_session_shards_free(a);
+    ssl3_buffer_pool_free(a->buffer_pool);
     X509_STORE_free(a->cert_store);
 #ifndef OPENSSL_NO_CT
     CTLOG_STORE_free(a->ctlog_store);
@@ -3162,8 +3783,12 @@ void SSL_CTX_free(SSL_CTX *a)
     OPENSSL_free(a->ext.supportedgroups);
 #endif
     OPENSSL_free(a->ext.alpn);
+    tls1_free_ticket_keys(a);
+    CRYPTO_THREAD_lock_free(a->ext.tick_keys_lock);
     OPENSSL_secure_free(a->ext.secure);
 
+    ssl_ctx_eph_key_pools_free(a);
+    CRYPTO_THREAD_lock_free(a->eph_pool_lock);
     CRYPTO_THREAD_lock_free(a->lock);
 
     OPENSSL_free(a);
@@ -3452,7 +4077,8 @@ void ssl_update_cache(SSL *s, int mode)
         else
             stat = &s->session_ctx->stats.sess_accept_good;
         if ((tsan_load(stat) & 0xff) == 0xff)
-            SSL_CTX_flush_sessions(s->session_ctx, (unsigned long)time(NULL));
+            ssl_session_cache_flush(s->session_ctx, (long)time(NULL),
+                                    SSL_SESSION_CACHE_AUTO_FLUSH_MAX);
     }
 }
 
@@ -4402,6 +5028,28 @@ int SSL_set_block_padding(SSL *ssl, size_t block_size)
     return 1;
 }
 
+int SSL_CTX_set_dynamic_record_size(SSL_CTX *ctx, size_t initial_size,
+                                    size_t ramp_bytes, long idle_timeout)
+{
+    if (initial_size > SSL3_RT_MAX_PLAIN_LENGTH || idle_timeout < 0)
+        return 0;
+    ctx->dynrec.initial_size = initial_size;
+    ctx->dynrec.ramp_bytes = ramp_bytes;
+    ctx->dynrec.idle_timeout = idle_timeout;
+    return 1;
+}
+
+int SSL_set_dynamic_record_size(SSL *s, size_t initial_size,
+                                size_t ramp_bytes, long idle_timeout)
+{
+    if (initial_size > SSL3_RT_MAX_PLAIN_LENGTH || idle_timeout < 0)
+        return 0;
+    s->dynrec.initial_size = initial_size;
+    s->dynrec.ramp_bytes = ramp_bytes;
+    s->dynrec.idle_timeout = idle_timeout;
+    return 1;
+}
+
 int SSL_set_num_tickets(SSL *s, size_t num_tickets)
 {
     s->num_tickets = num_tickets;
@@ -555,9 +555,12 @@ struct ssl_session_st {
     CRYPTO_EX_DATA ex_data;     /* application specific data */
     /*
      * These are used to make removal of session-ids more efficient and to
-     * implement a maximum cache size.
+     * implement a maximum cache size. The list they form is kept ordered by
+     * expiry time, with the session that expires first at the tail.
      */
     struct ssl_session_st *prev, *next;
+    /* The SSL_CTX whose internal cache holds this session, if any, under lock */
+    SSL_CTX *owner;
 
     struct {
         char *hostname;
@@ -651,6 +654,35 @@ typedef enum {
 
 #define MAX_COMPRESSIONS_SIZE   255
 
+/* Number of shards used by the internal session cache in sharded mode */
+# define SSL_SESSION_CACHE_SHARDS 16
+
+/*
+ * Most expired sessions removed by one automatic flush of the internal
+ * session cache, see SSL_SESS_CACHE_NO_AUTO_CLEAR. As the automatic flush
+ * happens every 255 connections this still removes expired sessions faster
+ * than new ones can be added.
+ */
+# define SSL_SESSION_CACHE_AUTO_FLUSH_MAX 1024
+
+/* A session cache in memory shared between processes, see ssl_sess_shm.c */
+typedef struct ssl_shm_sess_cache_st SSL_SHM_SESS_CACHE;
+
+/*
+ * One shard of the internal session cache when SSL_SESS_CACHE_SHARDED is set.
+ * Sessions are spread over the shards by a hash of their session ID and each
+ * shard has its own lock, hash table and session list, so that operations on
+ * sessions in different shards never contend with each other. The list is
+ * ordered by expiry time, the session expiring last at the head. Expired
+ * sessions are flushed, and a full shard evicts, from the tail.
+ */
+typedef struct ssl_session_shard_st {
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(SSL_SESSION) *sessions;
+    struct ssl_session_st *session_cache_head;
+    struct ssl_session_st *session_cache_tail;
+} SSL_SESSION_SHARD;
+
 struct ssl_comp_st {
     int id;
     const char *name;
@@ -715,6 +747,7 @@ typedef enum tlsext_index_en {
     TLSEXT_IDX_cryptopro_bug,
     TLSEXT_IDX_early_data,
     TLSEXT_IDX_certificate_authorities,
+    TLSEXT_IDX_compress_certificate,
     TLSEXT_IDX_padding,
     TLSEXT_IDX_psk,
     /* Dummy index - must always be the last entry */
@@ -733,6 +766,62 @@ typedef struct ssl_ctx_ext_secure_st {
     unsigned char tick_aes_key[TLSEXT_TICK_KEY_LENGTH];
 } SSL_CTX_EXT_SECURE;
 
+/* The most previous session ticket keys that can be kept for decryption */
+# define TLSEXT_TICK_KEY_HISTORY_MAX 8
+
+/*
+ * A session ticket key in the form of contexts that have already been keyed
+ * with it, so that protecting or unprotecting a ticket only has to copy them.
+ * |enc| is only set up for the current key.
+ */
+typedef struct ssl_ticket_key_st {
+    unsigned char name[TLSEXT_KEYNAME_LENGTH];
+    HMAC_CTX *hmac;
+    EVP_CIPHER_CTX *enc;
+    EVP_CIPHER_CTX *dec;
+} SSL_TICKET_KEY;
+
+/* The most certificate compression algorithms an SSL_CTX can have */
+# define SSL_CERT_COMP_MAX_ALGS 4
+
+/* An algorithm added with SSL_CTX_add_cert_compression_alg() */
+typedef struct ssl_cert_comp_method_st {
+    uint16_t alg;
+    SSL_cert_compress_cb_fn compress;
+    SSL_cert_decompress_cb_fn decompress;
+} SSL_CERT_COMP_METHOD;
+
+/*
+ * A Certificate message body compressed with |alg|, where |orig_len| is the
+ * uncompressed length. |data| is NULL if compression did not make the body
+ * any smaller. Copies kept in an SSL_CERT_MSG_CACHE also hold the body they
+ * were made from in |orig|, so that a later handshake can check they apply.
+ */
+typedef struct ssl_cert_comp_st {
+    uint16_t alg;
+    unsigned char *orig;
+    size_t orig_len;
+    unsigned char *data;
+    size_t len;
+} SSL_CERT_COMP;
+
+/*
+ * Ephemeral keys for |group_id| that have been generated ahead of time, see
+ * SSL_CTX_set_ephemeral_key_pool(). |keys| has room for the pool depth and
+ * holds |num| keys, each of which is handed out once and never reused. While
+ * |filling| is set a thread is generating keys for the pool, and handshakes
+ * that find it empty generate just their own key.
+ */
+typedef struct ssl_eph_key_pool_st {
+    uint16_t group_id;
+    size_t num;
+    EVP_PKEY **keys;
+    int filling;
+} SSL_EPH_KEY_POOL;
+
+/* Most keys generated for an ephemeral key pool in one go */
+# define SSL_EPH_KEY_POOL_BATCH  16
+
 struct ssl_ctx_st {
     const SSL_METHOD *method;
     STACK_OF(SSL_CIPHER) *cipher_list;
@@ -749,6 +838,27 @@ struct ssl_ctx_st {
     size_t session_cache_size;
     struct ssl_session_st *session_cache_head;
     struct ssl_session_st *session_cache_tail;
+    /*
+     * SSL_SESSION_CACHE_SHARDS shards used instead of the above when the
+     * session cache mode includes SSL_SESS_CACHE_SHARDED, NULL otherwise
+     */
+    SSL_SESSION_SHARD *session_shards;
+    /*
+     * Whether the internal cache is sharded. This can only change until the
+     * first SSL is created from the SSL_CTX, see |in_use|, so that the cache
+     * can read it without a lock.
+     */
+    int session_cache_sharded;
+    /*
+     * Set when the first SSL is created from the SSL_CTX. Settings that the
+     * SSL objects read without a lock can no longer change from then on.
+     */
+    TSAN_QUALIFIER int in_use;
+    /*
+     * Set up by SSL_CTX_set_shared_session_cache(), which also installs the
+     * external cache callbacks below to use it
+     */
+    SSL_SHM_SESS_CACHE *shm_sess_cache;
     /*
      * This can have one of 2 values, ored together, SSL_SESS_CACHE_CLIENT,
      * SSL_SESS_CACHE_SERVER, Default is SSL_SESSION_CACHE_SERVER, which
@@ -908,9 +1018,19 @@ struct ssl_ctx_st {
     /* Up to how many pipelines should we use? If 0 then 1 is assumed */
     size_t max_pipelines;
 
+    /* Dynamic record sizing defaults, see SSL_CTX_set_dynamic_record_size() */
+    struct {
+        size_t initial_size;
+        size_t ramp_bytes;
+        long idle_timeout;
+    } dynrec;
+
     /* The default read buffer length to use (0 means not set) */
     size_t default_read_buf_len;
 
+    /* Idle record buffers, see SSL_CTX_set_buffer_pool_size() */
+    SSL3_BUFFER_POOL *buffer_pool;
+
 # ifndef OPENSSL_NO_ENGINE
     /*
      * Engine to pass requests for client certs to
@@ -930,6 +1050,16 @@ struct ssl_ctx_st {
         /* RFC 4507 session ticket keys */
         unsigned char tick_key_name[TLSEXT_KEYNAME_LENGTH];
         SSL_CTX_EXT_SECURE *secure;
+        /*
+         * The key above followed by up to |tick_key_history| previous ones,
+         * most recent first. Protected by |tick_keys_lock|, which is kept
+         * apart from the SSL_CTX lock so that protecting and unprotecting
+         * tickets does not contend with the session cache.
+         */
+        SSL_TICKET_KEY tick_keys[TLSEXT_TICK_KEY_HISTORY_MAX + 1];
+        size_t tick_keys_num;
+        size_t tick_key_history;
+        CRYPTO_RWLOCK *tick_keys_lock;
         /* Callback to support customisation of ticket key setting */
         int (*ticket_key_cb) (SSL *ssl,
                               unsigned char *name, unsigned char *iv,
@@ -981,6 +1111,10 @@ struct ssl_ctx_st {
         unsigned char *alpn;
         size_t alpn_len;
 
+        /* Certificate compression algorithms, in order of preference */
+        SSL_CERT_COMP_METHOD cert_comp_meths[SSL_CERT_COMP_MAX_ALGS];
+        size_t cert_comp_meths_len;
+
 # ifndef OPENSSL_NO_NEXTPROTONEG
         /* Next protocol negotiation information */
 
@@ -1064,6 +1198,19 @@ struct ssl_ctx_st {
 
     /* Do we advertise Post-handshake auth support? */
     int pha_enabled;
+
+    /*
+     * Pools of pre-generated ephemeral keys, one per group, under
+     * |eph_pool_lock|. They belong to the process |eph_pool_pid|, and are
+     * dropped in a child after fork(). |eph_pool_gen| changes whenever they
+     * are dropped, so that keys generated for the old pools are discarded.
+     */
+    CRYPTO_RWLOCK *eph_pool_lock;
+    TSAN_QUALIFIER size_t eph_pool_depth;
+    SSL_EPH_KEY_POOL *eph_pools;
+    size_t eph_pools_len;
+    long eph_pool_pid;
+    unsigned int eph_pool_gen;
 };
 
 struct ssl_st {
@@ -1260,6 +1407,28 @@ struct ssl_st {
     size_t max_send_fragment;
     /* Up to how many pipelines should we use? If 0 then 1 is assumed */
     size_t max_pipelines;
+    /*
+     * Bytes already sent by an SSL_writev() call of |writev_total| bytes
+     * that has to be repeated, and the buffer that records spanning several
+     * of its buffers are gathered into.
+     */
+    size_t writev_done;
+    size_t writev_total;
+    unsigned char *writev_buf;
+    size_t writev_buf_len;
+
+    /* Dynamic record sizing, see SSL_set_dynamic_record_size() */
+    struct {
+        size_t initial_size;
+        size_t ramp_bytes;
+        long idle_timeout;
+        /* Application data sent since the last reset */
+        size_t sent;
+        time_t last_write;
+        /* Counters for SSL_get_dynamic_record_small() and friends */
+        size_t small_records;
+        size_t resets;
+    } dynrec;
 
     struct {
         /* Built-in extension flags */
@@ -1365,6 +1534,14 @@ struct ssl_st {
          * selected.
          */
         int tick_identity;
+
+        /*
+         * On the client side whether we offered to receive a compressed
+         * Certificate message. On the server side the algorithm picked from
+         * the client's list to compress ours with, or 0 if there is none.
+         */
+        int compress_certificate_sent;
+        uint16_t compress_certificate_alg;
     } ext;
 
     /*
@@ -1546,6 +1723,15 @@ typedef struct ssl3_state_st {
      * freed and MD_CTX for the required digest is stored here.
      */
     EVP_MD_CTX *handshake_dgst;
+    /*
+     * HMAC for the TLSv1.3 key schedule, kept keyed with the secret and
+     * digest it was last used with so that it is only rekeyed when they
+     * change.
+     */
+    HMAC_CTX *hkdf_hmac;
+    const EVP_MD *hkdf_md;
+    unsigned char hkdf_key[EVP_MAX_MD_SIZE];
+    size_t hkdf_keylen;
     /*
      * Set whenever an expected ChangeCipherSpec message is processed.
      * Unset when the peer's Finished message is received.
@@ -1615,6 +1801,8 @@ typedef struct ssl3_state_st {
         const SIGALG_LOOKUP *sigalg;
         /* Pointer to certificate we use */
         CERT_PKEY *cert;
+        /* Compressed Certificate message we are about to send */
+        SSL_CERT_COMP *cert_comp;
         /*
          * signature algorithms peer reports: e.g. supported signature
          * algorithms extension for server or as part of a certificate
@@ -1755,6 +1943,10 @@ struct pitem_st {
     unsigned char priority[8];  /* 64-bit value in big-endian encoding */
     void *data;
     pitem *next;
+    /* Treap links and weight, see pqueue.c */
+    pitem *left;
+    pitem *right;
+    uint32_t weight;
 };
 
 typedef struct pitem_st *piterator;
@@ -1813,6 +2005,40 @@ typedef struct dtls1_state_st {
 #  define NAMED_CURVE_TYPE           3
 # endif                         /* OPENSSL_NO_EC */
 
+/*
+ * The certificate list of a Certificate message, encoded once: each entry is
+ * a 24-bit length and the DER of one certificate. TLSv1.3 adds extensions
+ * after each entry, so |offs| records where entry i starts, and entry |num|
+ * ends. |certs| holds the leaf and its chain in the order sent. If the chain
+ * was built from |store|, it is only current while the store's generation
+ * is unchanged, otherwise it must match the leaf and explicit chain in use.
+ * A handshake holds its own reference while it writes the message, so that
+ * the cache lock is not held across custom extension callbacks.
+ */
+typedef struct ssl_cert_msg_st {
+    STACK_OF(X509) *certs;
+    X509_STORE *store;
+    unsigned long generation;
+    unsigned char *data;
+    size_t *offs;
+    int num;
+    CRYPTO_REF_COUNT references;
+    CRYPTO_RWLOCK *lock;
+} SSL_CERT_MSG;
+
+/*
+ * Holder of the encoded Certificate message for a CERT_PKEY, shared by the
+ * copies of the CERT_PKEY in every SSL made from the same SSL_CTX. |msg| is
+ * only replaced, never modified, under the write lock.
+ */
+typedef struct ssl_cert_msg_cache_st {
+    SSL_CERT_MSG *msg;
+    /* The last Certificate message body compressed with each algorithm */
+    SSL_CERT_COMP *comp[SSL_CERT_COMP_MAX_ALGS];
+    CRYPTO_REF_COUNT references;
+    CRYPTO_RWLOCK *lock;
+} SSL_CERT_MSG_CACHE;
+
 struct cert_pkey_st {
     X509 *x509;
     EVP_PKEY *privatekey;
@@ -1827,6 +2053,8 @@ struct cert_pkey_st {
      */
     unsigned char *serverinfo;
     size_t serverinfo_length;
+    /* Encoded Certificate message for this certificate and its chain */
+    SSL_CERT_MSG_CACHE *msgcache;
 };
 /* Retrieve Suite B flags */
 # define tls1_suiteb(s)  (s->cert->cert_flags & SSL_CERT_FLAG_SUITEB_128_LOS)
@@ -2257,10 +2485,29 @@ __owur CERT *ssl_cert_new(void);
 __owur CERT *ssl_cert_dup(CERT *cert);
 void ssl_cert_clear_certs(CERT *c);
 void ssl_cert_free(CERT *c);
+__owur SSL_CERT_MSG *ssl_cert_msg_new(STACK_OF(X509) *certs, X509_STORE *store,
+                                      unsigned long generation);
+int ssl_cert_msg_up_ref(SSL_CERT_MSG *msg);
+void ssl_cert_msg_free(SSL_CERT_MSG *msg);
+void ssl_cert_msg_cache_free(SSL_CERT_MSG_CACHE *cache);
+void ssl_cert_msg_cache_reset(CERT_PKEY *cpk);
+void ssl_cert_comp_free(SSL_CERT_COMP *comp);
+void ssl_ctx_eph_key_pools_free(SSL_CTX *ctx);
+const SSL_CERT_COMP_METHOD *ssl_cert_comp_method(const SSL_CTX *ctx,
+                                                 unsigned int alg);
 __owur int ssl_generate_session_id(SSL *s, SSL_SESSION *ss);
 __owur int ssl_get_new_session(SSL *s, int session);
 __owur SSL_SESSION *lookup_sess_in_cache(SSL *s, const unsigned char *sess_id,
                                          size_t sess_id_len);
+__owur SSL_SESSION *ssl_session_cache_find(SSL_CTX *ctx,
+                                           const SSL_SESSION *data, int ref);
+__owur size_t ssl_session_cache_num(SSL_CTX *ctx);
+void ssl_session_cache_flush(SSL_CTX *s, long t, size_t max);
+__owur uint32_t ssl_session_id_hash(const unsigned char *sess_id,
+                                   size_t sess_id_len);
+void ssl_shm_sess_cache_free(SSL_CTX *ctx);
+__owur int ssl_session_shards_new(SSL_CTX *ctx);
+void ssl_session_shards_free(SSL_CTX *ctx);
 __owur int ssl_get_prev_session(SSL *s, CLIENTHELLO_MSG *hello);
 __owur SSL_SESSION *ssl_session_dup(SSL_SESSION *src, int ticket);
 __owur int ssl_cipher_id_cmp(const SSL_CIPHER *a, const SSL_CIPHER *b);
@@ -2461,6 +2708,11 @@ __owur size_t tls13_final_finish_mac(SSL *s, const char *str, size_t slen,
                                      unsigned char *p);
 __owur int tls13_change_cipher_state(SSL *s, int which);
 __owur int tls13_update_key(SSL *s, int send);
+# ifndef OPENSSL_NO_KTLS
+int ssl_ktls_start(SSL *s, int is_tx, const EVP_CIPHER *c,
+                   const unsigned char *key, size_t keylen,
+                   const unsigned char *iv, size_t ivlen);
+# endif
 __owur int tls13_hkdf_expand(SSL *s, const EVP_MD *md,
                              const unsigned char *secret,
                              const unsigned char *label, size_t labellen,
@@ -2522,6 +2774,10 @@ void tls1_get_formatlist(SSL *s, const unsigned char **pformats,
                          size_t *num_formats);
 __owur int tls1_check_ec_tmp_key(SSL *s, unsigned long id);
 __owur EVP_PKEY *ssl_generate_pkey_group(SSL *s, uint16_t id);
+__owur EVP_PKEY *ssl_ctx_eph_key_pool_get(SSL_CTX *ctx, uint16_t id);
+__owur size_t ssl_generate_pkey_group_batch(uint16_t id, EVP_PKEY **keys,
+                                            size_t n);
+__owur uint16_t tls1_nid2group_id(int nid);
 __owur EVP_PKEY *ssl_generate_param_group(uint16_t id);
 #  endif                        /* OPENSSL_NO_EC */
 
@@ -2539,6 +2795,12 @@ __owur SSL_TICKET_STATUS tls_decrypt_ticket(SSL *s, const unsigned char *etick,
                                             size_t sesslen, SSL_SESSION **psess);
 
 __owur int tls_use_ticket(SSL *s);
+__owur int tls1_set_ticket_key(SSL_CTX *ctx, const unsigned char *name,
+                               const unsigned char *hmac_key,
+                               const unsigned char *aes_key);
+__owur int tls1_new_ticket_key(SSL_CTX *ctx);
+int tls1_set_ticket_key_history(SSL_CTX *ctx, size_t num);
+void tls1_free_ticket_keys(SSL_CTX *ctx);
 
 void ssl_set_sig_mask(uint32_t *pmask_a, SSL *s, int op);
 
@@ -369,6 +369,7 @@ static int ssl_set_cert(CERT *c, X509 *x)
     X509_up_ref(x);
     c->pkeys[i].x509 = x;
     c->key = &(c->pkeys[i]);
+    ssl_cert_msg_cache_reset(c->key);
 
     return 1;
 }
@@ -1122,6 +1123,7 @@ static int ssl_set_cert_and_key(SSL *ssl, SSL_CTX *ctx, X509 *x509, EVP_PKEY *pr
     X509_free(c->pkeys[i].x509);
     X509_up_ref(x509);
     c->pkeys[i].x509 = x509;
+    ssl_cert_msg_cache_reset(&c->pkeys[i]);
 
     EVP_PKEY_free(c->pkeys[i].privatekey);
     EVP_PKEY_up_ref(privatekey);
@@ -16,10 +16,91 @@
 #include "ssl_local.h"
 #include "statem/statem_local.h"
 
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s);
-static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s);
+/*
+ * The part of the internal session cache that holds the sessions with a
+ * particular session ID: the SSL_CTX's own hash table and expiry list protected
+ * by the SSL_CTX lock, or those of one of its shards if the cache is sharded.
+ */
+typedef struct sess_cache_part_st {
+    SSL_CTX *ctx;
+    CRYPTO_RWLOCK *lock;
+    LHASH_OF(SSL_SESSION) *sessions;
+    SSL_SESSION **head;
+    SSL_SESSION **tail;
+    /* Most sessions that will be cached in this part, 0 is unlimited */
+    size_t max;
+} SESS_CACHE_PART;
+
+static void SSL_SESSION_list_remove(SESS_CACHE_PART *part, SSL_SESSION *s);
+static void SSL_SESSION_list_add(SESS_CACHE_PART *part, SSL_SESSION *s);
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck);
 
+static void sess_cache_part_unsharded(SSL_CTX *ctx, SESS_CACHE_PART *part)
+{
+    part->ctx = ctx;
+    part->lock = ctx->lock;
+    part->sessions = ctx->sessions;
+    part->head = &ctx->session_cache_head;
+    part->tail = &ctx->session_cache_tail;
+    part->max = ctx->session_cache_size;
+}
+
+static void sess_cache_part_shard(SSL_CTX *ctx, size_t idx,
+                                  SESS_CACHE_PART *part)
+{
+    SSL_SESSION_SHARD *shard = &ctx->session_shards[idx];
+
+    part->ctx = ctx;
+    part->lock = shard->lock;
+    part->sessions = shard->sessions;
+    part->head = &shard->session_cache_head;
+    part->tail = &shard->session_cache_tail;
+    /* The cache size limit is split evenly between the shards */
+    part->max = (ctx->session_cache_size + SSL_SESSION_CACHE_SHARDS - 1)
+                / SSL_SESSION_CACHE_SHARDS;
+}
+
+/* The time at which |s| expires */
+static ossl_inline long sess_expiry(const SSL_SESSION *s)
+{
+    if (s->timeout > 0 && s->time > LONG_MAX - s->timeout)
+        return LONG_MAX;
+    return s->time + s->timeout;
+}
+
+static ossl_inline int sess_cache_is_sharded(const SSL_CTX *ctx)
+{
+    return ctx->session_cache_sharded;
+}
+
+/*
+ * FNV-1a over the whole session ID. The hash tables index their buckets with
+ * the first bytes of the ID, so anything that partitions sessions before they
+ * reach a hash table must not use those bytes alone or each partition would
+ * only ever use a fraction of its table's buckets.
+ */
+uint32_t ssl_session_id_hash(const unsigned char *sess_id, size_t sess_id_len)
+{
+    uint32_t h = 0x811c9dc5;
+    size_t i;
+
+    for (i = 0; i < sess_id_len; i++)
+        h = (h ^ sess_id[i]) * 0x01000193;
+    return h;
+}
+
+static void sess_cache_part(SSL_CTX *ctx, const unsigned char *sess_id,
+                            size_t sess_id_len, SESS_CACHE_PART *part)
+{
+    if (!sess_cache_is_sharded(ctx)) {
+        sess_cache_part_unsharded(ctx, part);
+        return;
+    }
+
+    sess_cache_part_shard(ctx, ssl_session_id_hash(sess_id, sess_id_len)
+                               % SSL_SESSION_CACHE_SHARDS, part);
+}
+
 /*
  * SSL_get_session() and SSL_get1_session() are problematic in TLS1.3 because,
  * unlike in earlier protocol versions, the session ticket may not have been
@@ -135,6 +216,7 @@ SSL_SESSION *ssl_session_dup(SSL_SESSION *src, int ticket)
     /* We deliberately don't copy the prev and next pointers */
     dest->prev = NULL;
     dest->next = NULL;
+    dest->owner = NULL;
 
     dest->references = 1;
 
@@ -416,6 +498,37 @@ int ssl_get_new_session(SSL *s, int session)
     return 1;
 }
 
+/*
+ * Look up the session matching |data| in the internal cache of |ctx|. If |ref|
+ * is set the caller gets a reference to the session returned.
+ */
+SSL_SESSION *ssl_session_cache_find(SSL_CTX *ctx, const SSL_SESSION *data,
+                                    int ref)
+{
+    SESS_CACHE_PART part;
+    SSL_SESSION *ret;
+
+    sess_cache_part(ctx, data->session_id, data->session_id_length, &part);
+    CRYPTO_THREAD_read_lock(part.lock);
+    ret = lh_SSL_SESSION_retrieve(part.sessions, data);
+    if (ret != NULL && ref)
+        SSL_SESSION_up_ref(ret);
+    CRYPTO_THREAD_unlock(part.lock);
+    return ret;
+}
+
+size_t ssl_session_cache_num(SSL_CTX *ctx)
+{
+    size_t i, num = 0;
+
+    if (!sess_cache_is_sharded(ctx))
+        return lh_SSL_SESSION_num_items(ctx->sessions);
+
+    for (i = 0; i < SSL_SESSION_CACHE_SHARDS; i++)
+        num += lh_SSL_SESSION_num_items(ctx->session_shards[i].sessions);
+    return num;
+}
+
 SSL_SESSION *lookup_sess_in_cache(SSL *s, const unsigned char *sess_id,
                                   size_t sess_id_len)
 {
@@ -432,13 +545,8 @@ SSL_SESSION *lookup_sess_in_cache(SSL *s, const unsigned char *sess_id,
         memcpy(data.session_id, sess_id, sess_id_len);
         data.session_id_length = sess_id_len;
 
-        CRYPTO_THREAD_read_lock(s->session_ctx->lock);
-        ret = lh_SSL_SESSION_retrieve(s->session_ctx->sessions, &data);
-        if (ret != NULL) {
-            /* don't allow other threads to steal it: */
-            SSL_SESSION_up_ref(ret);
-        }
-        CRYPTO_THREAD_unlock(s->session_ctx->lock);
+        /* don't allow other threads to steal it: */
+        ret = ssl_session_cache_find(s->session_ctx, &data, 1);
         if (ret == NULL)
             tsan_counter(&s->session_ctx->stats.sess_miss);
     }
@@ -638,6 +746,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 {
     int ret = 0;
     SSL_SESSION *s;
+    SESS_CACHE_PART part;
 
     /*
      * add just 1 reference count for the SSL_CTX's session cache even though
@@ -649,8 +758,9 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
      * if session c is in already in cache, we take back the increment later
      */
 
-    CRYPTO_THREAD_write_lock(ctx->lock);
-    s = lh_SSL_SESSION_insert(ctx->sessions, c);
+    sess_cache_part(ctx, c->session_id, c->session_id_length, &part);
+    CRYPTO_THREAD_write_lock(part.lock);
+    s = lh_SSL_SESSION_insert(part.sessions, c);
 
     /*
      * s != NULL iff we already had a session with the given PID. In this
@@ -659,7 +769,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
      */
     if (s != NULL && s != c) {
         /* We *are* in trouble ... */
-        SSL_SESSION_list_remove(ctx, s);
+        SSL_SESSION_list_remove(&part, s);
         SSL_SESSION_free(s);
         /*
          * ... so pretend the other session did not exist in cache (we cannot
@@ -669,7 +779,7 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
          */
         s = NULL;
     } else if (s == NULL &&
-               lh_SSL_SESSION_retrieve(ctx->sessions, c) == NULL) {
+               lh_SSL_SESSION_retrieve(part.sessions, c) == NULL) {
         /* s == NULL can also mean OOM error in lh_SSL_SESSION_insert ... */
 
         /*
@@ -679,10 +789,6 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
         s = c;
     }
 
-    /* Put at the head of the queue unless it is already in the cache */
-    if (s == NULL)
-        SSL_SESSION_list_add(ctx, c);
-
     if (s != NULL) {
         /*
          * existing cache entry -- decrement previously incremented reference
@@ -698,16 +804,22 @@ int SSL_CTX_add_session(SSL_CTX *ctx, SSL_SESSION *c)
 
         ret = 1;
 
-        if (SSL_CTX_sess_get_cache_size(ctx) > 0) {
-            while (SSL_CTX_sess_number(ctx) > SSL_CTX_sess_get_cache_size(ctx)) {
-                if (!remove_session_lock(ctx, ctx->session_cache_tail, 0))
+        if (part.max > 0) {
+            while (lh_SSL_SESSION_num_items(part.sessions) > part.max) {
+                if (!remove_session_lock(ctx, *part.tail, 0))
                     break;
                 else
                     tsan_counter(&ctx->stats.sess_cache_full);
             }
         }
+
+        /*
+         * Only now put it in the queue so that it can't be the session that
+         * was just removed to make room.
+         */
+        SSL_SESSION_list_add(&part, c);
     }
-    CRYPTO_THREAD_unlock(ctx->lock);
+    CRYPTO_THREAD_unlock(part.lock);
     return ret;
 }
 
@@ -719,20 +831,22 @@ int SSL_CTX_remove_session(SSL_CTX *ctx, SSL_SESSION *c)
 static int remove_session_lock(SSL_CTX *ctx, SSL_SESSION *c, int lck)
 {
     SSL_SESSION *r;
+    SESS_CACHE_PART part;
     int ret = 0;
 
     if ((c != NULL) && (c->session_id_length != 0)) {
+        sess_cache_part(ctx, c->session_id, c->session_id_length, &part);
         if (lck)
-            CRYPTO_THREAD_write_lock(ctx->lock);
-        if ((r = lh_SSL_SESSION_retrieve(ctx->sessions, c)) != NULL) {
+            CRYPTO_THREAD_write_lock(part.lock);
+        if ((r = lh_SSL_SESSION_retrieve(part.sessions, c)) != NULL) {
             ret = 1;
-            r = lh_SSL_SESSION_delete(ctx->sessions, r);
-            SSL_SESSION_list_remove(ctx, r);
+            r = lh_SSL_SESSION_delete(part.sessions, r);
+            SSL_SESSION_list_remove(&part, r);
         }
         c->not_resumable = 1;
 
         if (lck)
-            CRYPTO_THREAD_unlock(ctx->lock);
+            CRYPTO_THREAD_unlock(part.lock);
 
         if (ctx->remove_session_cb != NULL)
             ctx->remove_session_cb(ctx, c);
@@ -821,11 +935,58 @@ int SSL_SESSION_set1_id(SSL_SESSION *s, const unsigned char *sid,
     return 1;
 }
 
+/*
+ * The owner of a session is only known once it has been read, so it can't be
+ * protected by the lock of the cache holding the session. It is protected by
+ * the session's own lock instead, which is taken after the cache's lock.
+ */
+static SSL_CTX *sess_get_owner(SSL_SESSION *s)
+{
+    SSL_CTX *owner;
+
+    CRYPTO_THREAD_read_lock(s->lock);
+    owner = s->owner;
+    CRYPTO_THREAD_unlock(s->lock);
+    return owner;
+}
+
+static void sess_set_owner(SSL_SESSION *s, SSL_CTX *owner)
+{
+    CRYPTO_THREAD_write_lock(s->lock);
+    s->owner = owner;
+    CRYPTO_THREAD_unlock(s->lock);
+}
+
+/*
+ * Change the time and timeout of |s|. If it is in an internal session cache
+ * it is moved to its new place in the cache's expiry ordered list.
+ */
+static void sess_set_expiry(SSL_SESSION *s, long time, long timeout)
+{
+    SSL_CTX *owner = sess_get_owner(s);
+    SESS_CACHE_PART part;
+
+    if (owner == NULL) {
+        s->time = time;
+        s->timeout = timeout;
+        return;
+    }
+
+    sess_cache_part(owner, s->session_id, s->session_id_length, &part);
+    CRYPTO_THREAD_write_lock(part.lock);
+    s->time = time;
+    s->timeout = timeout;
+    /* Unless it was removed from the cache in the meantime */
+    if (sess_get_owner(s) == owner)
+        SSL_SESSION_list_add(&part, s);
+    CRYPTO_THREAD_unlock(part.lock);
+}
+
 long SSL_SESSION_set_timeout(SSL_SESSION *s, long t)
 {
     if (s == NULL)
         return 0;
-    s->timeout = t;
+    sess_set_expiry(s, s->time, t);
     return 1;
 }
 
@@ -847,7 +1008,7 @@ long SSL_SESSION_set_time(SSL_SESSION *s, long t)
 {
     if (s == NULL)
         return 0;
-    s->time = t;
+    sess_set_expiry(s, t, s->timeout);
     return t;
 }
 
@@ -1042,46 +1203,70 @@ int SSL_set_session_ticket_ext(SSL *s, void *ext_data, int ext_len)
     return 0;
 }
 
-typedef struct timeout_param_st {
-    SSL_CTX *ctx;
-    long time;
-    LHASH_OF(SSL_SESSION) *cache;
-} TIMEOUT_PARAM;
-
-static void timeout_cb(SSL_SESSION *s, TIMEOUT_PARAM *p)
+/*
+ * Remove the sessions in |part| that have expired at time |t|, or all of them
+ * if |t| is 0. The list is ordered by expiry, so this only needs to look at
+ * the sessions it removes plus one. If |budget| is not NULL at most |*budget|
+ * sessions are removed and |*budget| is reduced by the number removed.
+ */
+static void flush_sessions_part(SSL_CTX *s, SESS_CACHE_PART *part, long t,
+                                size_t *budget)
 {
-    if ((p->time == 0) || (p->time > (s->time + s->timeout))) { /* timeout */
+    SSL_SESSION *r;
+
+    if (budget != NULL && *budget == 0)
+        return;
+
+    CRYPTO_THREAD_write_lock(part->lock);
+    while ((r = *part->tail) != NULL
+           && (t == 0 || t > sess_expiry(r))) {
         /*
          * The reason we don't call SSL_CTX_remove_session() is to save on
          * locking overhead
          */
-        (void)lh_SSL_SESSION_delete(p->cache, s);
-        SSL_SESSION_list_remove(p->ctx, s);
-        s->not_resumable = 1;
-        if (p->ctx->remove_session_cb != NULL)
-            p->ctx->remove_session_cb(p->ctx, s);
-        SSL_SESSION_free(s);
+        (void)lh_SSL_SESSION_delete(part->sessions, r);
+        SSL_SESSION_list_remove(part, r);
+        r->not_resumable = 1;
+        if (s->remove_session_cb != NULL)
+            s->remove_session_cb(s, r);
+        SSL_SESSION_free(r);
+        if (budget != NULL && --*budget == 0)
+            break;
     }
+    CRYPTO_THREAD_unlock(part->lock);
 }
 
-IMPLEMENT_LHASH_DOALL_ARG(SSL_SESSION, TIMEOUT_PARAM);
-
-void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
+/*
+ * Remove the sessions that have expired at time |t| from the internal cache
+ * of |s|, but no more than |max| of them unless |max| is 0. If |t| is 0 all
+ * sessions are removed.
+ */
+void ssl_session_cache_flush(SSL_CTX *s, long t, size_t max)
 {
-    unsigned long i;
-    TIMEOUT_PARAM tp;
+    SESS_CACHE_PART part;
+    size_t *budget = (t != 0 && max != 0) ? &max : NULL;
+    size_t i;
 
-    tp.ctx = s;
-    tp.cache = s->sessions;
-    if (tp.cache == NULL)
+    if (s->sessions == NULL)
         return;
-    tp.time = t;
-    CRYPTO_THREAD_write_lock(s->lock);
-    i = lh_SSL_SESSION_get_down_load(s->sessions);
-    lh_SSL_SESSION_set_down_load(s->sessions, 0);
-    lh_SSL_SESSION_doall_TIMEOUT_PARAM(tp.cache, timeout_cb, &tp);
-    lh_SSL_SESSION_set_down_load(s->sessions, i);
-    CRYPTO_THREAD_unlock(s->lock);
+
+    /*
+     * Flush the shards even if the cache isn't currently sharded: switching
+     * modes relies on this to empty the cache that is no longer in use.
+     */
+    sess_cache_part_unsharded(s, &part);
+    flush_sessions_part(s, &part, t, budget);
+    if (s->session_shards != NULL) {
+        for (i = 0; i < SSL_SESSION_CACHE_SHARDS; i++) {
+            sess_cache_part_shard(s, i, &part);
+            flush_sessions_part(s, &part, t, budget);
+        }
+    }
+}
+
+void SSL_CTX_flush_sessions(SSL_CTX *s, long t)
+{
+    ssl_session_cache_flush(s, t, 0);
 }
 
 int ssl_clear_bad_session(SSL *s)
@@ -1095,27 +1280,27 @@ int ssl_clear_bad_session(SSL *s)
         return 0;
 }
 
-/* locked by SSL_CTX in the calling function */
-static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
+/* locked by the cache part's lock in the calling function */
+static void SSL_SESSION_list_remove(SESS_CACHE_PART *part, SSL_SESSION *s)
 {
     if ((s->next == NULL) || (s->prev == NULL))
         return;
 
-    if (s->next == (SSL_SESSION *)&(ctx->session_cache_tail)) {
+    if (s->next == (SSL_SESSION *)part->tail) {
         /* last element in list */
-        if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head)) {
+        if (s->prev == (SSL_SESSION *)part->head) {
             /* only one element in list */
-            ctx->session_cache_head = NULL;
-            ctx->session_cache_tail = NULL;
+            *part->head = NULL;
+            *part->tail = NULL;
         } else {
-            ctx->session_cache_tail = s->prev;
-            s->prev->next = (SSL_SESSION *)&(ctx->session_cache_tail);
+            *part->tail = s->prev;
+            s->prev->next = (SSL_SESSION *)part->tail;
         }
     } else {
-        if (s->prev == (SSL_SESSION *)&(ctx->session_cache_head)) {
+        if (s->prev == (SSL_SESSION *)part->head) {
             /* first element in list */
-            ctx->session_cache_head = s->next;
-            s->next->prev = (SSL_SESSION *)&(ctx->session_cache_head);
+            *part->head = s->next;
+            s->next->prev = (SSL_SESSION *)part->head;
         } else {
             /* middle of list */
             s->next->prev = s->prev;
@@ -1123,24 +1308,47 @@ static void SSL_SESSION_list_remove(SSL_CTX *ctx, SSL_SESSION *s)
         }
     }
     s->prev = s->next = NULL;
+    sess_set_owner(s, NULL);
 }
 
-static void SSL_SESSION_list_add(SSL_CTX *ctx, SSL_SESSION *s)
+static void SSL_SESSION_list_add(SESS_CACHE_PART *part, SSL_SESSION *s)
 {
-    if ((s->next != NULL) && (s->prev != NULL))
-        SSL_SESSION_list_remove(ctx, s);
+    SSL_SESSION *next;
 
-    if (ctx->session_cache_head == NULL) {
-        ctx->session_cache_head = s;
-        ctx->session_cache_tail = s;
-        s->prev = (SSL_SESSION *)&(ctx->session_cache_head);
-        s->next = (SSL_SESSION *)&(ctx->session_cache_tail);
-    } else {
-        s->next = ctx->session_cache_head;
+    if ((s->next != NULL) && (s->prev != NULL))
+        SSL_SESSION_list_remove(part, s);
+
+    if (*part->head == NULL) {
+        *part->head = s;
+        *part->tail = s;
+        s->prev = (SSL_SESSION *)part->head;
+        s->next = (SSL_SESSION *)part->tail;
+    } else if (sess_expiry(s) >= sess_expiry(*part->head)) {
+        /* The usual case: it expires no sooner than any other, put it first */
+        s->next = *part->head;
         s->next->prev = s;
-        s->prev = (SSL_SESSION *)&(ctx->session_cache_head);
-        ctx->session_cache_head = s;
+        s->prev = (SSL_SESSION *)part->head;
+        *part->head = s;
+    } else if (sess_expiry(s) < sess_expiry(*part->tail)) {
+        /* It expires before all others, put it last */
+        s->prev = *part->tail;
+        s->prev->next = s;
+        s->next = (SSL_SESSION *)part->tail;
+        *part->tail = s;
+    } else {
+        /*
+         * Somewhere in between, which is only possible when sessions have
+         * different timeouts. This stops at the tail at the latest.
+         */
+        next = (*part->head)->next;
+        while (sess_expiry(s) < sess_expiry(next))
+            next = next->next;
+        s->next = next;
+        s->prev = next->prev;
+        s->prev->next = s;
+        next->prev = s;
     }
+    sess_set_owner(s, part->ctx);
 }
 
 void SSL_CTX_sess_set_new_cb(SSL_CTX *ctx,
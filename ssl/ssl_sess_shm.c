@@ -0,0 +1,348 @@
+/*
+ * Copyright 2020 The OpenSSL Project Authors. All Rights Reserved.
+ *
+ * Licensed under the OpenSSL license (the "License").  You may not use
+ * this file except in compliance with the License.  You can obtain a copy
+ * in the file LICENSE in the source distribution or at
+ * https://www.openssl.org/source/license.html
+ */
+
+/*
+ * A session cache kept in anonymous shared memory, so that all processes
+ * forked after it was set up can resume each other's sessions. It plugs into
+ * the external session cache callbacks of an SSL_CTX.
+ *
+ * The memory holds a hash table of buckets, each protected by its own process
+ * shared mutex and holding SHM_BUCKET_SLOTS DER encoded sessions. A bucket
+ * that is full replaces the session that expires first.
+ */
+
+#include "e_os.h"
+#include "ssl_local.h"
+
+#if defined(OPENSSL_SYS_UNIX) && defined(OPENSSL_THREADS)
+# include <sys/types.h>
+# include <sys/mman.h>
+# include <fcntl.h>
+# include <pthread.h>
+# include <errno.h>
+# include <unistd.h>
+# if defined(_POSIX_VERSION) && _POSIX_VERSION >= 200809L
+/* Robust mutexes let us recover from a process dying with a bucket locked */
+#  define SHM_ROBUST_MUTEX
+# endif
+# if !defined(MAP_ANON) && defined(MAP_ANONYMOUS)
+#  define MAP_ANON MAP_ANONYMOUS
+# endif
+
+# define SHM_BUCKET_SLOTS        8
+# define SHM_DEFAULT_SESSION_LEN 1024
+# define SHM_ALIGN               64
+
+typedef struct shm_slot_st {
+    /* Expiry time of the session held, 0 if the slot is free */
+    long expires;
+    unsigned int id_len;
+    unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    unsigned int der_len;
+    /* The DER encoding of the session follows */
+} SHM_SLOT;
+
+struct ssl_shm_sess_cache_st {
+    unsigned char *map;
+    size_t map_size;
+    size_t nbuckets;
+    size_t bucket_size;
+    size_t slot_size;
+    size_t max_der_len;
+};
+
+# define SHM_ROUND_UP(x, a) (((x) + (a) - 1) / (a) * (a))
+
+static ossl_inline pthread_mutex_t *shm_bucket(SSL_SHM_SESS_CACHE *cache,
+                                               const unsigned char *id,
+                                               size_t id_len)
+{
+    size_t idx = ssl_session_id_hash(id, id_len) % cache->nbuckets;
+
+    return (pthread_mutex_t *)(cache->map + idx * cache->bucket_size);
+}
+
+static ossl_inline SHM_SLOT *shm_slot(SSL_SHM_SESS_CACHE *cache,
+                                      pthread_mutex_t *bucket, size_t i)
+{
+    return (SHM_SLOT *)((unsigned char *)bucket
+                        + SHM_ROUND_UP(sizeof(*bucket), sizeof(long))
+                        + i * cache->slot_size);
+}
+
+static int shm_lock(SSL_SHM_SESS_CACHE *cache, pthread_mutex_t *bucket)
+{
+    int ret = pthread_mutex_lock(bucket);
+# ifdef SHM_ROBUST_MUTEX
+    size_t i;
+
+    if (ret == EOWNERDEAD) {
+        /* The previous owner died, maybe half way through writing a slot */
+        for (i = 0; i < SHM_BUCKET_SLOTS; i++)
+            shm_slot(cache, bucket, i)->expires = 0;
+        ret = pthread_mutex_consistent(bucket);
+    }
+# endif
+    return ret == 0;
+}
+
+/* Find the slot holding the session with the given ID, or NULL */
+static SHM_SLOT *shm_find(SSL_SHM_SESS_CACHE *cache, pthread_mutex_t *bucket,
+                          const unsigned char *id, size_t id_len)
+{
+    SHM_SLOT *slot;
+    size_t i;
+
+    for (i = 0; i < SHM_BUCKET_SLOTS; i++) {
+        slot = shm_slot(cache, bucket, i);
+        if (slot->expires != 0 && slot->id_len == id_len
+                && memcmp(slot->id, id, id_len) == 0)
+            return slot;
+    }
+    return NULL;
+}
+
+static long shm_expiry(const SSL_SESSION *sess)
+{
+    long t = SSL_SESSION_get_time(sess), timeout = SSL_SESSION_get_timeout(sess);
+
+    if (timeout > 0 && t > LONG_MAX - timeout)
+        return LONG_MAX;
+    return t + timeout;
+}
+
+static int shm_new_session_cb(SSL *s, SSL_SESSION *sess)
+{
+    SSL_SHM_SESS_CACHE *cache = s->session_ctx->shm_sess_cache;
+    pthread_mutex_t *bucket;
+    SHM_SLOT *slot, *tmp;
+    unsigned char *p;
+    int der_len;
+    size_t i;
+
+    if (cache == NULL || sess->session_id_length == 0)
+        return 0;
+    der_len = i2d_SSL_SESSION(sess, NULL);
+    if (der_len <= 0 || (size_t)der_len > cache->max_der_len)
+        return 0;
+
+    bucket = shm_bucket(cache, sess->session_id, sess->session_id_length);
+    if (!shm_lock(cache, bucket))
+        return 0;
+
+    /* Replace the same session, else use a free slot or evict */
+    slot = shm_find(cache, bucket, sess->session_id, sess->session_id_length);
+    for (i = 0; slot == NULL && i < SHM_BUCKET_SLOTS; i++) {
+        tmp = shm_slot(cache, bucket, i);
+        if (tmp->expires == 0)
+            slot = tmp;
+    }
+    if (slot == NULL) {
+        slot = shm_slot(cache, bucket, 0);
+        for (i = 1; i < SHM_BUCKET_SLOTS; i++) {
+            tmp = shm_slot(cache, bucket, i);
+            if (tmp->expires < slot->expires)
+                slot = tmp;
+        }
+    }
+
+    p = (unsigned char *)(slot + 1);
+    if (i2d_SSL_SESSION(sess, &p) == der_len) {
+        slot->id_len = (unsigned int)sess->session_id_length;
+        memcpy(slot->id, sess->session_id, sess->session_id_length);
+        slot->der_len = (unsigned int)der_len;
+        slot->expires = shm_expiry(sess);
+    } else {
+        slot->expires = 0;
+    }
+    pthread_mutex_unlock(bucket);
+
+    /* We didn't keep a reference to |sess| */
+    return 0;
+}
+
+static SSL_SESSION *shm_get_session_cb(SSL *s, const unsigned char *id,
+                                       int id_len, int *copy)
+{
+    SSL_SHM_SESS_CACHE *cache = s->session_ctx->shm_sess_cache;
+    pthread_mutex_t *bucket;
+    SHM_SLOT *slot;
+    SSL_SESSION *ret = NULL;
+    const unsigned char *p;
+
+    /* The session returned is a new one that the caller owns */
+    *copy = 0;
+    if (cache == NULL || id_len <= 0
+            || id_len > SSL_MAX_SSL_SESSION_ID_LENGTH)
+        return NULL;
+
+    bucket = shm_bucket(cache, id, id_len);
+    if (!shm_lock(cache, bucket))
+        return NULL;
+    slot = shm_find(cache, bucket, id, id_len);
+    if (slot != NULL) {
+        if (slot->expires < (long)time(NULL)) {
+            slot->expires = 0;
+        } else {
+            p = (const unsigned char *)(slot + 1);
+            ret = d2i_SSL_SESSION(NULL, &p, slot->der_len);
+        }
+    }
+    pthread_mutex_unlock(bucket);
+    return ret;
+}
+
+static void shm_remove_session_cb(SSL_CTX *ctx, SSL_SESSION *sess)
+{
+    SSL_SHM_SESS_CACHE *cache = ctx->shm_sess_cache;
+    pthread_mutex_t *bucket;
+    SHM_SLOT *slot;
+
+    if (cache == NULL || sess->session_id_length == 0)
+        return;
+
+    bucket = shm_bucket(cache, sess->session_id, sess->session_id_length);
+    if (!shm_lock(cache, bucket))
+        return;
+    slot = shm_find(cache, bucket, sess->session_id, sess->session_id_length);
+    if (slot != NULL)
+        slot->expires = 0;
+    pthread_mutex_unlock(bucket);
+}
+
+static void shm_sess_cache_free(SSL_SHM_SESS_CACHE *cache)
+{
+    if (cache == NULL)
+        return;
+    /*
+     * Other processes may still be using the mutexes, so they are not
+     * destroyed: the memory goes away with the last process mapping it.
+     */
+    munmap(cache->map, cache->map_size);
+    OPENSSL_free(cache);
+}
+
+/*
+ * Detach |ctx| from its shared session cache. The callbacks stay installed
+ * but do nothing any more, so that sessions flushed from the internal cache
+ * of |ctx| afterwards remain available to the other processes.
+ */
+void ssl_shm_sess_cache_free(SSL_CTX *ctx)
+{
+    shm_sess_cache_free(ctx->shm_sess_cache);
+    ctx->shm_sess_cache = NULL;
+}
+
+int SSL_CTX_set_shared_session_cache(SSL_CTX *ctx, size_t num_sessions,
+                                     size_t max_session_len)
+{
+    SSL_SHM_SESS_CACHE *cache;
+    pthread_mutexattr_t attr;
+    size_t i;
+
+    if (num_sessions == 0) {
+        ssl_shm_sess_cache_free(ctx);
+        if (ctx->new_session_cb == shm_new_session_cb) {
+            ctx->new_session_cb = NULL;
+            ctx->get_session_cb = NULL;
+            ctx->remove_session_cb = NULL;
+        }
+        return 1;
+    }
+
+    if (max_session_len == 0)
+        max_session_len = SHM_DEFAULT_SESSION_LEN;
+
+    if ((cache = OPENSSL_zalloc(sizeof(*cache))) == NULL) {
+        SSLerr(SSL_F_SSL_CTX_SET_SHARED_SESSION_CACHE, ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    cache->max_der_len = max_session_len;
+    cache->nbuckets = (num_sessions + SHM_BUCKET_SLOTS - 1) / SHM_BUCKET_SLOTS;
+    cache->slot_size = SHM_ROUND_UP(sizeof(SHM_SLOT) + max_session_len,
+                                    sizeof(long));
+    cache->bucket_size = SHM_ROUND_UP(SHM_ROUND_UP(sizeof(pthread_mutex_t),
+                                                   sizeof(long))
+                                      + SHM_BUCKET_SLOTS * cache->slot_size,
+                                      SHM_ALIGN);
+    if (max_session_len > UINT_MAX
+            || cache->slot_size < max_session_len
+            || cache->nbuckets > SIZE_MAX / cache->bucket_size) {
+        OPENSSL_free(cache);
+        SSLerr(SSL_F_SSL_CTX_SET_SHARED_SESSION_CACHE,
+               SSL_R_SHARED_SESSION_CACHE_TOO_LARGE);
+        return 0;
+    }
+    cache->map_size = cache->nbuckets * cache->bucket_size;
+
+# ifdef MAP_ANON
+    cache->map = mmap(NULL, cache->map_size, PROT_READ | PROT_WRITE,
+                      MAP_ANON | MAP_SHARED, -1, 0);
+# else
+    {
+        int fd;
+
+        cache->map = MAP_FAILED;
+        if ((fd = open("/dev/zero", O_RDWR)) >= 0) {
+            cache->map = mmap(NULL, cache->map_size, PROT_READ | PROT_WRITE,
+                              MAP_SHARED, fd, 0);
+            close(fd);
+        }
+    }
+# endif
+    if (cache->map == MAP_FAILED) {
+        SYSerr(SYS_F_MMAP, get_last_sys_error());
+        OPENSSL_free(cache);
+        SSLerr(SSL_F_SSL_CTX_SET_SHARED_SESSION_CACHE, ERR_R_SYS_LIB);
+        return 0;
+    }
+
+    /* The mapping is zero filled, so all slots start out free */
+    pthread_mutexattr_init(&attr);
+    pthread_mutexattr_setpshared(&attr, PTHREAD_PROCESS_SHARED);
+# ifdef SHM_ROBUST_MUTEX
+    pthread_mutexattr_setrobust(&attr, PTHREAD_MUTEX_ROBUST);
+# endif
+    for (i = 0; i < cache->nbuckets; i++) {
+        if (pthread_mutex_init((pthread_mutex_t *)(cache->map
+                                                   + i * cache->bucket_size),
+                               &attr) != 0) {
+            pthread_mutexattr_destroy(&attr);
+            shm_sess_cache_free(cache);
+            SSLerr(SSL_F_SSL_CTX_SET_SHARED_SESSION_CACHE, ERR_R_SYS_LIB);
+            return 0;
+        }
+    }
+    pthread_mutexattr_destroy(&attr);
+
+    ssl_shm_sess_cache_free(ctx);
+    ctx->shm_sess_cache = cache;
+    ctx->new_session_cb = shm_new_session_cb;
+    ctx->get_session_cb = shm_get_session_cb;
+    ctx->remove_session_cb = shm_remove_session_cb;
+    return 1;
+}
+
+#else
+
+void ssl_shm_sess_cache_free(SSL_CTX *ctx)
+{
+}
+
+int SSL_CTX_set_shared_session_cache(SSL_CTX *ctx, size_t num_sessions,
+                                     size_t max_session_len)
+{
+    if (num_sessions == 0)
+        return 1;
+    SSLerr(SSL_F_SSL_CTX_SET_SHARED_SESSION_CACHE,
+           SSL_R_SHARED_SESSION_CACHE_NOT_SUPPORTED);
+    return 0;
+}
+
+#endif
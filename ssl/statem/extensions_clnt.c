@@ -1214,6 +1214,52 @@ EXT_RETURN tls_construct_ctos_post_handshake_auth(SSL *s, WPACKET *pkt,
 #endif
 }
 
+EXT_RETURN tls_construct_ctos_compress_certificate(SSL *s, WPACKET *pkt,
+                                                   unsigned int context,
+                                                   X509 *x, size_t chainidx)
+{
+    const SSL_CERT_COMP_METHOD *meth;
+    size_t i;
+
+    s->ext.compress_certificate_sent = 0;
+
+    /* Only offer the algorithms we are able to decompress */
+    for (i = 0; i < s->ctx->ext.cert_comp_meths_len; i++) {
+        if (s->ctx->ext.cert_comp_meths[i].decompress != NULL)
+            break;
+    }
+    if (i == s->ctx->ext.cert_comp_meths_len)
+        return EXT_RETURN_NOT_SENT;
+
+    if (!WPACKET_put_bytes_u16(pkt, TLSEXT_TYPE_compress_certificate)
+            || !WPACKET_start_sub_packet_u16(pkt)
+            || !WPACKET_start_sub_packet_u8(pkt)) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_CONSTRUCT_CTOS_COMPRESS_CERTIFICATE,
+                 ERR_R_INTERNAL_ERROR);
+        return EXT_RETURN_FAIL;
+    }
+    for (; i < s->ctx->ext.cert_comp_meths_len; i++) {
+        meth = &s->ctx->ext.cert_comp_meths[i];
+        if (meth->decompress != NULL
+                && !WPACKET_put_bytes_u16(pkt, meth->alg)) {
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                     SSL_F_TLS_CONSTRUCT_CTOS_COMPRESS_CERTIFICATE,
+                     ERR_R_INTERNAL_ERROR);
+            return EXT_RETURN_FAIL;
+        }
+    }
+    if (!WPACKET_close(pkt) || !WPACKET_close(pkt)) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_CONSTRUCT_CTOS_COMPRESS_CERTIFICATE,
+                 ERR_R_INTERNAL_ERROR);
+        return EXT_RETURN_FAIL;
+    }
+
+    s->ext.compress_certificate_sent = 1;
+
+    return EXT_RETURN_SENT;
+}
 
 /*
  * Parse the server's renegotiation binding and abort if it's not right
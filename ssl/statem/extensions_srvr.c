@@ -1298,6 +1298,41 @@ int tls_parse_ctos_post_handshake_auth(SSL *s, PACKET *pkt, unsigned int context
     return 1;
 }
 
+int tls_parse_ctos_compress_certificate(SSL *s, PACKET *pkt,
+                                        unsigned int context, X509 *x,
+                                        size_t chainidx)
+{
+    PACKET algs, tmp;
+    const SSL_CERT_COMP_METHOD *meth;
+    unsigned int alg;
+    size_t i;
+
+    if (!PACKET_as_length_prefixed_1(pkt, &algs)
+            || PACKET_remaining(&algs) == 0
+            || (PACKET_remaining(&algs) & 1) != 0) {
+        SSLfatal(s, SSL_AD_DECODE_ERROR,
+                 SSL_F_TLS_PARSE_CTOS_COMPRESS_CERTIFICATE,
+                 SSL_R_BAD_EXTENSION);
+        return 0;
+    }
+
+    /* Use the first of our algorithms that the client can decompress */
+    for (i = 0; i < s->ctx->ext.cert_comp_meths_len; i++) {
+        meth = &s->ctx->ext.cert_comp_meths[i];
+        if (meth->compress == NULL)
+            continue;
+        tmp = algs;
+        while (PACKET_get_net_2(&tmp, &alg)) {
+            if (alg == meth->alg) {
+                s->ext.compress_certificate_alg = meth->alg;
+                return 1;
+            }
+        }
+    }
+
+    return 1;
+}
+
 /*
  * Add the server's renegotiation binding
  */
@@ -1712,10 +1747,9 @@ EXT_RETURN tls_construct_stoc_key_share(SSL *s, WPACKET *pkt,
         return EXT_RETURN_FAIL;
     }
 
-    skey = ssl_generate_pkey(ckey);
+    skey = ssl_generate_pkey_group(s, s->s3->group_id);
     if (skey == NULL) {
-        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS_CONSTRUCT_STOC_KEY_SHARE,
-                 ERR_R_MALLOC_FAILURE);
+        /* SSLfatal() already called */
         return EXT_RETURN_FAIL;
     }
 
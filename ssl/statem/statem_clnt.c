@@ -125,7 +125,9 @@ static int ossl_statem_client13_read_transition(SSL *s, int mt)
                 st->hand_state = TLS_ST_CR_CERT_REQ;
                 return 1;
             }
-            if (mt == SSL3_MT_CERTIFICATE) {
+            if (mt == SSL3_MT_CERTIFICATE
+                    || (mt == SSL3_MT_COMPRESSED_CERTIFICATE
+                        && s->ext.compress_certificate_sent)) {
                 st->hand_state = TLS_ST_CR_CERT;
                 return 1;
             }
@@ -133,7 +135,9 @@ static int ossl_statem_client13_read_transition(SSL *s, int mt)
         break;
 
     case TLS_ST_CR_CERT_REQ:
-        if (mt == SSL3_MT_CERTIFICATE) {
+        if (mt == SSL3_MT_CERTIFICATE
+                || (mt == SSL3_MT_COMPRESSED_CERTIFICATE
+                    && s->ext.compress_certificate_sent)) {
             st->hand_state = TLS_ST_CR_CERT;
             return 1;
         }
@@ -1036,6 +1040,8 @@ MSG_PROCESS_RETURN ossl_statem_client_process_message(SSL *s, PACKET *pkt)
         return dtls_process_hello_verify(s, pkt);
 
     case TLS_ST_CR_CERT:
+        if (s->s3->tmp.message_type == SSL3_MT_COMPRESSED_CERTIFICATE)
+            return tls_process_server_compressed_certificate(s, pkt);
         return tls_process_server_certificate(s, pkt);
 
     case TLS_ST_CR_CERT_VRFY:
@@ -1811,6 +1817,70 @@ static MSG_PROCESS_RETURN tls_process_as_hello_retry_request(SSL *s,
     return MSG_PROCESS_ERROR;
 }
 
+/*
+ * Decompress a CompressedCertificate message (RFC 8879) and process the
+ * Certificate message inside it.
+ */
+MSG_PROCESS_RETURN tls_process_server_compressed_certificate(SSL *s,
+                                                             PACKET *pkt)
+{
+    MSG_PROCESS_RETURN ret = MSG_PROCESS_ERROR;
+    const SSL_CERT_COMP_METHOD *meth;
+    unsigned int alg;
+    unsigned long len;
+    unsigned char *buf = NULL;
+    PACKET compressed, body;
+
+    if (!PACKET_get_net_2(pkt, &alg)
+            || !PACKET_get_net_3(pkt, &len)
+            || !PACKET_get_length_prefixed_3(pkt, &compressed)
+            || PACKET_remaining(pkt) != 0) {
+        SSLfatal(s, SSL_AD_DECODE_ERROR,
+                 SSL_F_TLS_PROCESS_SERVER_COMPRESSED_CERTIFICATE,
+                 SSL_R_LENGTH_MISMATCH);
+        goto err;
+    }
+    /* We only offered the algorithms we can decompress */
+    meth = ssl_cert_comp_method(s->ctx, alg);
+    if (meth == NULL || meth->decompress == NULL) {
+        SSLfatal(s, SSL_AD_ILLEGAL_PARAMETER,
+                 SSL_F_TLS_PROCESS_SERVER_COMPRESSED_CERTIFICATE,
+                 SSL_R_UNSUPPORTED_COMPRESSION_ALGORITHM);
+        goto err;
+    }
+    if (len == 0 || len > s->max_cert_list) {
+        SSLfatal(s, SSL_AD_BAD_CERTIFICATE,
+                 SSL_F_TLS_PROCESS_SERVER_COMPRESSED_CERTIFICATE,
+                 SSL_R_EXCESSIVE_MESSAGE_SIZE);
+        goto err;
+    }
+    if ((buf = OPENSSL_malloc(len)) == NULL) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_PROCESS_SERVER_COMPRESSED_CERTIFICATE,
+                 ERR_R_MALLOC_FAILURE);
+        goto err;
+    }
+    if (!meth->decompress(s, PACKET_data(&compressed),
+                          PACKET_remaining(&compressed), buf, len)) {
+        SSLfatal(s, SSL_AD_BAD_CERTIFICATE,
+                 SSL_F_TLS_PROCESS_SERVER_COMPRESSED_CERTIFICATE,
+                 SSL_R_BAD_DECOMPRESSION);
+        goto err;
+    }
+    if (!PACKET_buf_init(&body, buf, len)) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_PROCESS_SERVER_COMPRESSED_CERTIFICATE,
+                 ERR_R_INTERNAL_ERROR);
+        goto err;
+    }
+
+    ret = tls_process_server_certificate(s, &body);
+
+ err:
+    OPENSSL_free(buf);
+    return ret;
+}
+
 MSG_PROCESS_RETURN tls_process_server_certificate(SSL *s, PACKET *pkt)
 {
     int i;
@@ -2870,6 +2940,15 @@ MSG_PROCESS_RETURN tls_process_server_done(SSL *s, PACKET *pkt)
         return MSG_PROCESS_ERROR;
     }
 
+    /*
+     * Without a CertificateRequest we will never sign the handshake messages,
+     * so the buffered copy can go now rather than at the Finished message.
+     */
+    if (!s->s3->tmp.cert_req && !ssl3_digest_cached_records(s, 0)) {
+        /* SSLfatal() already called */
+        return MSG_PROCESS_ERROR;
+    }
+
     return MSG_PROCESS_FINISHED_READING;
 }
 
@@ -905,19 +905,108 @@ static int ssl_add_cert_to_wpacket(SSL *s, WPACKET *pkt, X509 *x, int chain)
     return 1;
 }
 
-/* Add certificate chain to provided WPACKET */
+/*
+ * Check whether |msg| holds the certificates that would be sent now: leaf |x|
+ * with a chain built from |store| at |generation| or, without a store, with
+ * the chain |extra_certs|.
+ */
+static int ssl_cert_msg_current(const SSL_CERT_MSG *msg, X509 *x,
+                                STACK_OF(X509) *extra_certs,
+                                X509_STORE *store, unsigned long generation)
+{
+    int i, num = sk_X509_num(extra_certs);
+
+    if (msg == NULL || sk_X509_value(msg->certs, 0) != x
+            || msg->store != store)
+        return 0;
+    if (store != NULL)
+        return msg->generation == generation;
+
+    if (num < 0)
+        num = 0;
+    if (msg->num != num + 1)
+        return 0;
+    for (i = 0; i < num; i++)
+        if (sk_X509_value(msg->certs, i + 1) != sk_X509_value(extra_certs, i))
+            return 0;
+    return 1;
+}
+
+static int ssl_add_cert_security(SSL *s, STACK_OF(X509) *certs)
+{
+    int i = ssl_security_cert_chain(s, certs, NULL, 0);
+
+    if (i != 1) {
+#if 0
+        /* Dummy error calls so mkerr generates them */
+        SSLerr(SSL_F_SSL_ADD_CERT_CHAIN, SSL_R_EE_KEY_TOO_SMALL);
+        SSLerr(SSL_F_SSL_ADD_CERT_CHAIN, SSL_R_CA_KEY_TOO_SMALL);
+        SSLerr(SSL_F_SSL_ADD_CERT_CHAIN, SSL_R_CA_MD_TOO_WEAK);
+#endif
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN, i);
+        return 0;
+    }
+    return 1;
+}
+
+/* Add the certificates encoded in |msg| to provided WPACKET */
+static int ssl_add_cert_msg(SSL *s, WPACKET *pkt, const SSL_CERT_MSG *msg)
+{
+    int i;
+
+    if (!ssl_add_cert_security(s, msg->certs)) {
+        /* SSLfatal() already called */
+        return 0;
+    }
+
+    if (!SSL_IS_TLS13(s)) {
+        if (!WPACKET_memcpy(pkt, msg->data, msg->offs[msg->num])) {
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN,
+                     ERR_R_INTERNAL_ERROR);
+            return 0;
+        }
+        return 1;
+    }
+
+    /* In TLSv1.3 each certificate is followed by its extensions */
+    for (i = 0; i < msg->num; i++) {
+        if (!WPACKET_memcpy(pkt, msg->data + msg->offs[i],
+                            msg->offs[i + 1] - msg->offs[i])) {
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN,
+                     ERR_R_INTERNAL_ERROR);
+            return 0;
+        }
+        if (!tls_construct_extensions(s, pkt, SSL_EXT_TLS1_3_CERTIFICATE,
+                                      sk_X509_value(msg->certs, i), i)) {
+            /* SSLfatal() already called */
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*
+ * Add certificate chain to provided WPACKET. The encoded certificates are
+ * cached with |cpk|, so that later handshakes can copy them as long as the
+ * certificate and its chain stay the same.
+ */
 static int ssl_add_cert_chain(SSL *s, WPACKET *pkt, CERT_PKEY *cpk)
 {
-    int i, chain_count;
+    int i, ret = 0;
     X509 *x;
     STACK_OF(X509) *extra_certs;
-    STACK_OF(X509) *chain = NULL;
+    STACK_OF(X509) *chain = NULL, *certs = NULL;
     X509_STORE *chain_store;
+    X509_STORE_CTX *xs_ctx = NULL;
+    SSL_CERT_MSG_CACHE *cache;
+    SSL_CERT_MSG *msg;
+    unsigned long generation = 0;
 
     if (cpk == NULL || cpk->x509 == NULL)
         return 1;
 
     x = cpk->x509;
+    cache = cpk->msgcache;
 
     /*
      * If we have a certificate specific chain use it, else use parent ctx.
@@ -934,8 +1023,31 @@ static int ssl_add_cert_chain(SSL *s, WPACKET *pkt, CERT_PKEY *cpk)
     else
         chain_store = s->ctx->cert_store;
 
+    /* A chain built from a store is only reused until the store changes */
+    if (chain_store != NULL)
+        generation = X509_STORE_get_generation(chain_store);
+
+    if (cache != NULL) {
+        /*
+         * Writing the message may call custom extension callbacks, so take a
+         * reference to it and write it without the lock held.
+         */
+        msg = NULL;
+        CRYPTO_THREAD_read_lock(cache->lock);
+        if (ssl_cert_msg_current(cache->msg, x, extra_certs, chain_store,
+                                 generation)
+                && ssl_cert_msg_up_ref(cache->msg))
+            msg = cache->msg;
+        CRYPTO_THREAD_unlock(cache->lock);
+        if (msg != NULL) {
+            ret = ssl_add_cert_msg(s, pkt, msg);
+            ssl_cert_msg_free(msg);
+            return ret;
+        }
+    }
+
     if (chain_store != NULL) {
-        X509_STORE_CTX *xs_ctx = X509_STORE_CTX_new();
+        xs_ctx = X509_STORE_CTX_new();
 
         if (xs_ctx == NULL) {
             SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN,
@@ -958,48 +1070,48 @@ static int ssl_add_cert_chain(SSL *s, WPACKET *pkt, CERT_PKEY *cpk)
         /* Don't leave errors in the queue */
         ERR_clear_error();
         chain = X509_STORE_CTX_get0_chain(xs_ctx);
-        i = ssl_security_cert_chain(s, chain, NULL, 0);
-        if (i != 1) {
-#if 0
-            /* Dummy error calls so mkerr generates them */
-            SSLerr(SSL_F_SSL_ADD_CERT_CHAIN, SSL_R_EE_KEY_TOO_SMALL);
-            SSLerr(SSL_F_SSL_ADD_CERT_CHAIN, SSL_R_CA_KEY_TOO_SMALL);
-            SSLerr(SSL_F_SSL_ADD_CERT_CHAIN, SSL_R_CA_MD_TOO_WEAK);
-#endif
-            X509_STORE_CTX_free(xs_ctx);
-            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN, i);
-            return 0;
-        }
-        chain_count = sk_X509_num(chain);
-        for (i = 0; i < chain_count; i++) {
-            x = sk_X509_value(chain, i);
-
-            if (!ssl_add_cert_to_wpacket(s, pkt, x, i)) {
-                /* SSLfatal() already called */
-                X509_STORE_CTX_free(xs_ctx);
-                return 0;
-            }
-        }
-        X509_STORE_CTX_free(xs_ctx);
     } else {
-        i = ssl_security_cert_chain(s, extra_certs, x, 0);
-        if (i != 1) {
-            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN, i);
+        /* The leaf followed by the explicit chain */
+        if ((certs = sk_X509_new_reserve(NULL,
+                                         sk_X509_num(extra_certs) + 1)) == NULL
+                || !sk_X509_push(certs, x)) {
+            sk_X509_free(certs);
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_SSL_ADD_CERT_CHAIN,
+                     ERR_R_MALLOC_FAILURE);
             return 0;
         }
-        if (!ssl_add_cert_to_wpacket(s, pkt, x, 0)) {
+        for (i = 0; i < sk_X509_num(extra_certs); i++)
+            sk_X509_push(certs, sk_X509_value(extra_certs, i));
+        chain = certs;
+    }
+
+    if (cache != NULL
+            && (msg = ssl_cert_msg_new(chain, chain_store, generation)) != NULL) {
+        ret = ssl_add_cert_msg(s, pkt, msg);
+        CRYPTO_THREAD_write_lock(cache->lock);
+        ssl_cert_msg_free(cache->msg);
+        cache->msg = msg;
+        CRYPTO_THREAD_unlock(cache->lock);
+        goto end;
+    }
+
+    /* Without a cache, encode each certificate straight into the message */
+    if (!ssl_add_cert_security(s, chain)) {
+        /* SSLfatal() already called */
+        goto end;
+    }
+    for (i = 0; i < sk_X509_num(chain); i++) {
+        if (!ssl_add_cert_to_wpacket(s, pkt, sk_X509_value(chain, i), i)) {
             /* SSLfatal() already called */
-            return 0;
-        }
-        for (i = 0; i < sk_X509_num(extra_certs); i++) {
-            x = sk_X509_value(extra_certs, i);
-            if (!ssl_add_cert_to_wpacket(s, pkt, x, i + 1)) {
-                /* SSLfatal() already called */
-                return 0;
-            }
+            goto end;
         }
     }
-    return 1;
+    ret = 1;
+
+ end:
+    sk_X509_free(certs);
+    X509_STORE_CTX_free(xs_ctx);
+    return ret;
 }
 
 unsigned long ssl3_output_cert_chain(SSL *s, WPACKET *pkt, CERT_PKEY *cpk)
@@ -1028,8 +1028,18 @@ int ossl_statem_server_construct_message(SSL *s, WPACKET *pkt,
         break;
 
     case TLS_ST_SW_CERT:
-        *confunc = tls_construct_server_certificate;
-        *mt = SSL3_MT_CERTIFICATE;
+        if (!tls_prepare_compressed_certificate(s)) {
+            /* SSLfatal() already called */
+            return 0;
+        }
+        if (s->s3->tmp.cert_comp != NULL) {
+            *confunc = tls_construct_server_compressed_certificate;
+            *mt = s->s3->tmp.cert_comp->data != NULL
+                  ? SSL3_MT_COMPRESSED_CERTIFICATE : SSL3_MT_CERTIFICATE;
+        } else {
+            *confunc = tls_construct_server_certificate;
+            *mt = SSL3_MT_CERTIFICATE;
+        }
         break;
 
     case TLS_ST_SW_CERT_VRFY:
@@ -2439,10 +2449,15 @@ int tls_construct_server_hello(SSL *s, WPACKET *pkt)
             /* SSLfatal() already called */
             return 0;
         }
-    } else if (!(s->verify_mode & SSL_VERIFY_PEER)
-                && !ssl3_digest_cached_records(s, 0)) {
-        /* SSLfatal() already called */;
-        return 0;
+    } else if (SSL_IS_TLS13(s) || !(s->verify_mode & SSL_VERIFY_PEER)) {
+        /*
+         * Only a TLSv1.2 CertificateVerify signs the raw handshake messages,
+         * everything else works from the running hash.
+         */
+        if (!ssl3_digest_cached_records(s, 0)) {
+            /* SSLfatal() already called */
+            return 0;
+        }
     }
 
     return 1;
@@ -3790,6 +3805,203 @@ int tls_construct_server_certificate(SSL *s, WPACKET *pkt)
     return 1;
 }
 
+/*
+ * Look for the compressed form of |body| in |cache|, and copy it if there is
+ * one. Returns 1 on a hit, 0 on a miss or on failure.
+ */
+static int cert_comp_cache_get(SSL_CERT_MSG_CACHE *cache, unsigned int alg,
+                               const unsigned char *body, size_t len,
+                               SSL_CERT_COMP *comp)
+{
+    const SSL_CERT_COMP *cached;
+    int ret = 0;
+    size_t i;
+
+    if (!CRYPTO_THREAD_read_lock(cache->lock))
+        return 0;
+    for (i = 0; i < OSSL_NELEM(cache->comp); i++) {
+        cached = cache->comp[i];
+        if (cached == NULL || cached->alg != alg)
+            continue;
+        if (cached->orig_len == len && memcmp(cached->orig, body, len) == 0) {
+            if (cached->data == NULL) {
+                ret = 1;
+            } else if ((comp->data = OPENSSL_memdup(cached->data,
+                                                    cached->len)) != NULL) {
+                comp->len = cached->len;
+                ret = 1;
+            }
+        }
+        break;
+    }
+    CRYPTO_THREAD_unlock(cache->lock);
+
+    return ret;
+}
+
+/*
+ * Keep a copy of |comp|, made from |body|, in |cache| in place of whatever
+ * was there for the same algorithm. Failure just means the next handshake
+ * has to compress again.
+ */
+static void cert_comp_cache_put(SSL_CERT_MSG_CACHE *cache,
+                                const unsigned char *body,
+                                const SSL_CERT_COMP *comp)
+{
+    SSL_CERT_COMP *new;
+    size_t i, slot = OSSL_NELEM(cache->comp);
+
+    if ((new = OPENSSL_zalloc(sizeof(*new))) == NULL)
+        return;
+    new->alg = comp->alg;
+    new->orig_len = comp->orig_len;
+    new->len = comp->len;
+    if ((new->orig = OPENSSL_memdup(body, comp->orig_len)) == NULL
+            || (comp->data != NULL
+                && (new->data = OPENSSL_memdup(comp->data,
+                                               comp->len)) == NULL)
+            || !CRYPTO_THREAD_write_lock(cache->lock)) {
+        ssl_cert_comp_free(new);
+        return;
+    }
+    for (i = 0; i < OSSL_NELEM(cache->comp); i++) {
+        if (cache->comp[i] != NULL && cache->comp[i]->alg == new->alg) {
+            slot = i;
+            break;
+        }
+        if (cache->comp[i] == NULL && slot == OSSL_NELEM(cache->comp))
+            slot = i;
+    }
+    if (slot < OSSL_NELEM(cache->comp)) {
+        ssl_cert_comp_free(cache->comp[slot]);
+        cache->comp[slot] = new;
+        new = NULL;
+    }
+    CRYPTO_THREAD_unlock(cache->lock);
+    ssl_cert_comp_free(new);
+}
+
+/*
+ * Compress our Certificate message with the algorithm the client asked for
+ * in its compress_certificate extension (RFC 8879), if any. The result is
+ * kept with the CERT_PKEY and reused for as long as the uncompressed message
+ * stays the same, so each chain is only compressed once rather than on every
+ * handshake. If compression fails, or does not make the message smaller,
+ * the uncompressed message is sent in a plain Certificate message instead.
+ */
+int tls_prepare_compressed_certificate(SSL *s)
+{
+    CERT_PKEY *cpk = s->s3->tmp.cert;
+    const SSL_CERT_COMP_METHOD *meth;
+    SSL_CERT_COMP *comp = NULL;
+    BUF_MEM *buf = NULL;
+    WPACKET pkt;
+    size_t len;
+    int ret = 0;
+
+    ssl_cert_comp_free(s->s3->tmp.cert_comp);
+    s->s3->tmp.cert_comp = NULL;
+
+    if (!SSL_IS_TLS13(s) || s->ext.compress_certificate_alg == 0
+            || cpk == NULL)
+        return 1;
+    /* The servername callback may have switched us to a different SSL_CTX */
+    meth = ssl_cert_comp_method(s->ctx, s->ext.compress_certificate_alg);
+    if (meth == NULL || meth->compress == NULL)
+        return 1;
+
+    if ((buf = BUF_MEM_new()) == NULL || !WPACKET_init(&pkt, buf)) {
+        BUF_MEM_free(buf);
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_PREPARE_COMPRESSED_CERTIFICATE,
+                 ERR_R_MALLOC_FAILURE);
+        return 0;
+    }
+    if (!tls_construct_server_certificate(s, &pkt)) {
+        /* SSLfatal() already called */
+        WPACKET_cleanup(&pkt);
+        goto err;
+    }
+    if (!WPACKET_get_total_written(&pkt, &len) || !WPACKET_finish(&pkt)) {
+        WPACKET_cleanup(&pkt);
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_PREPARE_COMPRESSED_CERTIFICATE,
+                 ERR_R_INTERNAL_ERROR);
+        goto err;
+    }
+
+    if ((comp = OPENSSL_zalloc(sizeof(*comp))) == NULL) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_PREPARE_COMPRESSED_CERTIFICATE,
+                 ERR_R_MALLOC_FAILURE);
+        goto err;
+    }
+    comp->alg = meth->alg;
+    comp->orig_len = len;
+
+    if (cpk->msgcache == NULL
+            || !cert_comp_cache_get(cpk->msgcache, meth->alg,
+                                    (unsigned char *)buf->data, len, comp)) {
+        if ((comp->data = OPENSSL_malloc(len)) == NULL) {
+            SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                     SSL_F_TLS_PREPARE_COMPRESSED_CERTIFICATE,
+                     ERR_R_MALLOC_FAILURE);
+            goto err;
+        }
+        comp->len = len;
+        if (!meth->compress(s, (unsigned char *)buf->data, len, comp->data,
+                            &comp->len)
+                || comp->len == 0 || comp->len >= len) {
+            OPENSSL_free(comp->data);
+            comp->data = NULL;
+            comp->len = 0;
+        }
+        if (cpk->msgcache != NULL)
+            cert_comp_cache_put(cpk->msgcache, (unsigned char *)buf->data,
+                                comp);
+    }
+
+    /* Keep the uncompressed message in case it is to be sent as it is */
+    comp->orig = (unsigned char *)buf->data;
+    buf->data = NULL;
+    s->s3->tmp.cert_comp = comp;
+    comp = NULL;
+    ret = 1;
+ err:
+    ssl_cert_comp_free(comp);
+    BUF_MEM_free(buf);
+    return ret;
+}
+
+/*
+ * Write the message made by tls_prepare_compressed_certificate(): a
+ * CompressedCertificate message, or the body of a plain Certificate message
+ * if compression did not pay off.
+ */
+int tls_construct_server_compressed_certificate(SSL *s, WPACKET *pkt)
+{
+    SSL_CERT_COMP *comp = s->s3->tmp.cert_comp;
+
+    if (comp == NULL
+            || (comp->data == NULL
+                && !WPACKET_memcpy(pkt, comp->orig, comp->orig_len))
+            || (comp->data != NULL
+                && (!WPACKET_put_bytes_u16(pkt, comp->alg)
+                    || !WPACKET_put_bytes_u24(pkt, comp->orig_len)
+                    || !WPACKET_sub_memcpy_u24(pkt, comp->data,
+                                               comp->len)))) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR,
+                 SSL_F_TLS_CONSTRUCT_SERVER_COMPRESSED_CERTIFICATE,
+                 ERR_R_INTERNAL_ERROR);
+        return 0;
+    }
+
+    ssl_cert_comp_free(comp);
+    s->s3->tmp.cert_comp = NULL;
+
+    return 1;
+}
+
 static int create_ticket_prequel(SSL *s, WPACKET *pkt, uint32_t age_add,
                                  unsigned char *tick_nonce)
 {
@@ -3935,21 +4147,25 @@ static int construct_stateless_ticket(SSL *s, WPACKET *pkt, uint32_t age_add,
         }
         iv_len = EVP_CIPHER_CTX_iv_length(ctx);
     } else {
-        const EVP_CIPHER *cipher = EVP_aes_256_cbc();
-
-        iv_len = EVP_CIPHER_iv_length(cipher);
-        if (RAND_bytes(iv, iv_len) <= 0
-                || !EVP_EncryptInit_ex(ctx, cipher, NULL,
-                                       tctx->ext.secure->tick_aes_key, iv)
-                || !HMAC_Init_ex(hctx, tctx->ext.secure->tick_hmac_key,
-                                 sizeof(tctx->ext.secure->tick_hmac_key),
-                                 EVP_sha256(), NULL)) {
+        int keyed;
+
+        /* Copy the contexts already keyed with the current key */
+        CRYPTO_THREAD_read_lock(tctx->ext.tick_keys_lock);
+        keyed = tctx->ext.tick_keys_num > 0
+                && HMAC_CTX_copy(hctx, tctx->ext.tick_keys[0].hmac)
+                && EVP_CIPHER_CTX_copy(ctx, tctx->ext.tick_keys[0].enc);
+        if (keyed)
+            memcpy(key_name, tctx->ext.tick_keys[0].name,
+                   sizeof(tctx->ext.tick_keys[0].name));
+        CRYPTO_THREAD_unlock(tctx->ext.tick_keys_lock);
+        if (!keyed
+                || (iv_len = EVP_CIPHER_CTX_iv_length(ctx)) <= 0
+                || RAND_bytes(iv, iv_len) <= 0
+                || !EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, iv)) {
             SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_CONSTRUCT_STATELESS_TICKET,
                      ERR_R_INTERNAL_ERROR);
             goto err;
         }
-        memcpy(key_name, tctx->ext.tick_key_name,
-               sizeof(tctx->ext.tick_key_name));
     }
 
     if (!create_ticket_prequel(s, pkt, age_add, tick_nonce)) {
@@ -312,6 +312,16 @@ int tls1_change_cipher_state(SSL *s, int which)
                  ERR_R_INTERNAL_ERROR);
         goto err;
     }
+#ifndef OPENSSL_NO_KTLS
+    /* ktls doesn't support renegotiation */
+    if ((which & SSL3_CC_WRITE) ? BIO_get_ktls_send(s->wbio)
+                                : BIO_get_ktls_recv(s->rbio)) {
+        SSLfatal(s, SSL_AD_NO_RENEGOTIATION, SSL_F_TLS1_CHANGE_CIPHER_STATE,
+                 ERR_R_INTERNAL_ERROR);
+        goto err;
+    }
+    ssl_ktls_start(s, (which & SSL3_CC_WRITE) != 0, c, key, cl, iv, k);
+#endif
     s->statem.enc_write_state = ENC_WRITE_STATE_VALID;
 
 #ifdef SSL_DEBUG
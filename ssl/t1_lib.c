@@ -12,6 +12,7 @@
 #include <openssl/objects.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ocsp.h>
 #include <openssl/conf.h>
 #include <openssl/x509v3.h>
@@ -198,7 +199,7 @@ const TLS_GROUP_INFO *tls1_group_id_lookup(uint16_t group_id)
     return &nid_list[group_id - 1];
 }
 
-static uint16_t tls1_nid2group_id(int nid)
+uint16_t tls1_nid2group_id(int nid)
 {
     size_t i;
     for (i = 0; i < OSSL_NELEM(nid_list); i++) {
@@ -1211,6 +1212,100 @@ int tls_use_ticket(SSL *s)
     return ssl_security(s, SSL_SECOP_TICKET, 0, 0, NULL);
 }
 
+static void ticket_key_clear(SSL_TICKET_KEY *key)
+{
+    HMAC_CTX_free(key->hmac);
+    EVP_CIPHER_CTX_free(key->enc);
+    EVP_CIPHER_CTX_free(key->dec);
+    memset(key, 0, sizeof(*key));
+}
+
+/*
+ * Make the given key the one that new session tickets are protected with.
+ * The contexts for it are keyed here once, and the key it replaces is kept
+ * for decryption if a key history has been configured.
+ */
+int tls1_set_ticket_key(SSL_CTX *ctx, const unsigned char *name,
+                        const unsigned char *hmac_key,
+                        const unsigned char *aes_key)
+{
+    const EVP_CIPHER *cipher = EVP_aes_256_cbc();
+    SSL_TICKET_KEY key, *keys = ctx->ext.tick_keys;
+    size_t last;
+
+    memset(&key, 0, sizeof(key));
+    memcpy(key.name, name, sizeof(key.name));
+    if ((key.hmac = HMAC_CTX_new()) == NULL
+            || (key.enc = EVP_CIPHER_CTX_new()) == NULL
+            || (key.dec = EVP_CIPHER_CTX_new()) == NULL
+            || !HMAC_Init_ex(key.hmac, hmac_key, TLSEXT_TICK_KEY_LENGTH,
+                             EVP_sha256(), NULL)
+            || !EVP_EncryptInit_ex(key.enc, cipher, NULL, aes_key, NULL)
+            || !EVP_DecryptInit_ex(key.dec, cipher, NULL, aes_key, NULL)) {
+        ticket_key_clear(&key);
+        return 0;
+    }
+
+    CRYPTO_THREAD_write_lock(ctx->ext.tick_keys_lock);
+    last = ctx->ext.tick_key_history;
+    ticket_key_clear(&keys[last]);
+    memmove(&keys[1], &keys[0], last * sizeof(keys[0]));
+    keys[0] = key;
+    if (last > 0) {
+        /* The previous key is only used for decryption from now on */
+        EVP_CIPHER_CTX_free(keys[1].enc);
+        keys[1].enc = NULL;
+    }
+    if (ctx->ext.tick_keys_num <= last)
+        ctx->ext.tick_keys_num++;
+    memcpy(ctx->ext.tick_key_name, name, sizeof(ctx->ext.tick_key_name));
+    memcpy(ctx->ext.secure->tick_hmac_key, hmac_key,
+           sizeof(ctx->ext.secure->tick_hmac_key));
+    memcpy(ctx->ext.secure->tick_aes_key, aes_key,
+           sizeof(ctx->ext.secure->tick_aes_key));
+    CRYPTO_THREAD_unlock(ctx->ext.tick_keys_lock);
+    return 1;
+}
+
+/* Generate a new random session ticket key and make it the current one */
+int tls1_new_ticket_key(SSL_CTX *ctx)
+{
+    unsigned char name[TLSEXT_KEYNAME_LENGTH];
+    unsigned char secret[2 * TLSEXT_TICK_KEY_LENGTH];
+    int ret = 0;
+
+    /* Both secret keys come out of a single call to the private DRBG */
+    if (RAND_bytes(name, sizeof(name)) > 0
+            && RAND_priv_bytes(secret, sizeof(secret)) > 0)
+        ret = tls1_set_ticket_key(ctx, name, secret,
+                                  secret + TLSEXT_TICK_KEY_LENGTH);
+    OPENSSL_cleanse(secret, sizeof(secret));
+    return ret;
+}
+
+/* Set how many previous session ticket keys are kept for decryption */
+int tls1_set_ticket_key_history(SSL_CTX *ctx, size_t num)
+{
+    if (num > TLSEXT_TICK_KEY_HISTORY_MAX)
+        return 0;
+
+    CRYPTO_THREAD_write_lock(ctx->ext.tick_keys_lock);
+    while (ctx->ext.tick_keys_num > num + 1)
+        ticket_key_clear(&ctx->ext.tick_keys[--ctx->ext.tick_keys_num]);
+    ctx->ext.tick_key_history = num;
+    CRYPTO_THREAD_unlock(ctx->ext.tick_keys_lock);
+    return 1;
+}
+
+void tls1_free_ticket_keys(SSL_CTX *ctx)
+{
+    size_t i;
+
+    for (i = 0; i < ctx->ext.tick_keys_num; i++)
+        ticket_key_clear(&ctx->ext.tick_keys[i]);
+    ctx->ext.tick_keys_num = 0;
+}
+
 int tls1_set_server_sigalgs(SSL *s)
 {
     size_t i;
@@ -1387,20 +1482,35 @@ SSL_TICKET_STATUS tls_decrypt_ticket(SSL *s, const unsigned char *etick,
             renew_ticket = 1;
     } else {
         /* Check key name matches */
-        if (memcmp(etick, tctx->ext.tick_key_name,
-                   TLSEXT_KEYNAME_LENGTH) != 0) {
+        const SSL_TICKET_KEY *key = NULL;
+        size_t i;
+        int ok;
+
+        CRYPTO_THREAD_read_lock(tctx->ext.tick_keys_lock);
+        for (i = 0; i < tctx->ext.tick_keys_num; i++) {
+            if (memcmp(etick, tctx->ext.tick_keys[i].name,
+                       TLSEXT_KEYNAME_LENGTH) == 0) {
+                key = &tctx->ext.tick_keys[i];
+                break;
+            }
+        }
+        ok = key != NULL
+             && HMAC_CTX_copy(hctx, key->hmac)
+             && EVP_CIPHER_CTX_copy(ctx, key->dec);
+        CRYPTO_THREAD_unlock(tctx->ext.tick_keys_lock);
+        if (key == NULL) {
             ret = SSL_TICKET_NO_DECRYPT;
             goto end;
         }
-        if (HMAC_Init_ex(hctx, tctx->ext.secure->tick_hmac_key,
-                         sizeof(tctx->ext.secure->tick_hmac_key),
-                         EVP_sha256(), NULL) <= 0
-            || EVP_DecryptInit_ex(ctx, EVP_aes_256_cbc(), NULL,
-                                  tctx->ext.secure->tick_aes_key,
+        if (!ok
+            || EVP_DecryptInit_ex(ctx, NULL, NULL, NULL,
                                   etick + TLSEXT_KEYNAME_LENGTH) <= 0) {
             ret = SSL_TICKET_FATAL_ERR_OTHER;
             goto end;
         }
+        /* Replace tickets protected with a previous key */
+        if (i > 0)
+            renew_ticket = 1;
         if (SSL_IS_TLS13(s))
             renew_ticket = 1;
     }
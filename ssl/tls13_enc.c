@@ -11,13 +11,93 @@
 #include "ssl_local.h"
 #include "internal/cryptlib.h"
 #include <openssl/evp.h>
-#include <openssl/kdf.h>
+#include <openssl/hmac.h>
 
 #define TLS13_MAX_LABEL_LEN     249
 
 /* Always filled with zeros */
 static const unsigned char default_zeros[EVP_MAX_MD_SIZE];
 
+/*
+ * Return the HMAC used for the key schedule of |s|, initialised for |md| and
+ * keyed with |key| of length |keylen|. The same secret is typically used for
+ * several derivations in a row, so the HMAC_CTX is kept with the connection,
+ * and if it is already keyed with |key| it is only reset rather than keyed
+ * again. Returns NULL on failure.
+ */
+static HMAC_CTX *tls13_hmac_init(SSL *s, const EVP_MD *md,
+                                 const unsigned char *key, size_t keylen)
+{
+    SSL3_STATE *s3 = s->s3;
+
+    if (s3->hkdf_hmac == NULL && (s3->hkdf_hmac = HMAC_CTX_new()) == NULL)
+        return NULL;
+
+    if (s3->hkdf_md == md && s3->hkdf_keylen == keylen
+            && CRYPTO_memcmp(s3->hkdf_key, key, keylen) == 0)
+        return HMAC_Init_ex(s3->hkdf_hmac, NULL, 0, NULL, NULL)
+               ? s3->hkdf_hmac : NULL;
+
+    s3->hkdf_md = NULL;
+    if (keylen > INT_MAX
+            || !HMAC_Init_ex(s3->hkdf_hmac, key, (int)keylen, md, NULL))
+        return NULL;
+    /*
+     * The keys used here are the early, handshake and master secrets and the
+     * secrets derived from them, as the PRK for HKDF-Expand or the salt for
+     * HKDF-Extract, so they are no longer than the hash. A longer key is just
+     * not remembered, and keys the HMAC again on its next use.
+     */
+    if (keylen <= sizeof(s3->hkdf_key)) {
+        memcpy(s3->hkdf_key, key, keylen);
+        s3->hkdf_keylen = keylen;
+        s3->hkdf_md = md;
+    }
+    return s3->hkdf_hmac;
+}
+
+/*
+ * HKDF-Expand (RFC 5869) of |info| with the pseudorandom key |prk|, which is
+ * as long as the output of |md|. |out| may overlap |prk|. Returns 1 on
+ * success 0 on failure.
+ */
+static int tls13_hkdf_expand_info(SSL *s, const EVP_MD *md,
+                                  const unsigned char *prk,
+                                  const unsigned char *info, size_t infolen,
+                                  unsigned char *out, size_t outlen)
+{
+    HMAC_CTX *hmac;
+    unsigned char block[EVP_MAX_MD_SIZE];
+    unsigned char ctr;
+    size_t mdlen, done, n;
+    int mdleni = EVP_MD_size(md), ret = 0;
+
+    if (mdleni <= 0)
+        return 0;
+    mdlen = (size_t)mdleni;
+    if (outlen > 255 * mdlen
+            || (hmac = tls13_hmac_init(s, md, prk, mdlen)) == NULL)
+        return 0;
+
+    for (done = 0, ctr = 1; done < outlen; done += n, ctr++) {
+        /* T(i) = HMAC(PRK, T(i - 1) | info | i), with T(0) empty */
+        if ((ctr > 1
+                && (!HMAC_Init_ex(hmac, NULL, 0, NULL, NULL)
+                    || !HMAC_Update(hmac, block, mdlen)))
+                || !HMAC_Update(hmac, info, infolen)
+                || !HMAC_Update(hmac, &ctr, 1)
+                || !HMAC_Final(hmac, block, NULL))
+            goto err;
+        n = outlen - done < mdlen ? outlen - done : mdlen;
+        memcpy(out + done, block, n);
+    }
+
+    ret = 1;
+ err:
+    OPENSSL_cleanse(block, sizeof(block));
+    return ret;
+}
+
 /*
  * Given a |secret|; a |label| of length |labellen|; and |data| of length
  * |datalen| (e.g. typically a hash of the handshake messages), derive a new
@@ -35,10 +115,7 @@ int tls13_hkdf_expand(SSL *s, const EVP_MD *md, const unsigned char *secret,
 #else
     static const unsigned char label_prefix[] = "tls13 ";
 #endif
-    EVP_PKEY_CTX *pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, NULL);
-    int ret;
     size_t hkdflabellen;
-    size_t hashlen;
     /*
      * 2 bytes for length of derived secret + 1 byte for length of combined
      * prefix and label + bytes for the label itself + 1 byte length of hash
@@ -49,9 +126,6 @@ int tls13_hkdf_expand(SSL *s, const EVP_MD *md, const unsigned char *secret,
                             + 1 + EVP_MAX_MD_SIZE];
     WPACKET pkt;
 
-    if (pctx == NULL)
-        return 0;
-
     if (labellen > TLS13_MAX_LABEL_LEN) {
         if (fatal) {
             SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_HKDF_EXPAND,
@@ -63,12 +137,9 @@ int tls13_hkdf_expand(SSL *s, const EVP_MD *md, const unsigned char *secret,
              */
             SSLerr(SSL_F_TLS13_HKDF_EXPAND, SSL_R_TLS_ILLEGAL_EXPORTER_LABEL);
         }
-        EVP_PKEY_CTX_free(pctx);
         return 0;
     }
 
-    hashlen = EVP_MD_size(md);
-
     if (!WPACKET_init_static_len(&pkt, hkdflabel, sizeof(hkdflabel), 0)
             || !WPACKET_put_bytes_u16(&pkt, outlen)
             || !WPACKET_start_sub_packet_u8(&pkt)
@@ -77,8 +148,9 @@ int tls13_hkdf_expand(SSL *s, const EVP_MD *md, const unsigned char *secret,
             || !WPACKET_close(&pkt)
             || !WPACKET_sub_memcpy_u8(&pkt, data, (data == NULL) ? 0 : datalen)
             || !WPACKET_get_total_written(&pkt, &hkdflabellen)
-            || !WPACKET_finish(&pkt)) {
-        EVP_PKEY_CTX_free(pctx);
+            || !WPACKET_finish(&pkt)
+            || !tls13_hkdf_expand_info(s, md, secret, hkdflabel, hkdflabellen,
+                                       out, outlen)) {
         WPACKET_cleanup(&pkt);
         if (fatal)
             SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_HKDF_EXPAND,
@@ -88,25 +160,7 @@ int tls13_hkdf_expand(SSL *s, const EVP_MD *md, const unsigned char *secret,
         return 0;
     }
 
-    ret = EVP_PKEY_derive_init(pctx) <= 0
-            || EVP_PKEY_CTX_hkdf_mode(pctx, EVP_PKEY_HKDEF_MODE_EXPAND_ONLY)
-               <= 0
-            || EVP_PKEY_CTX_set_hkdf_md(pctx, md) <= 0
-            || EVP_PKEY_CTX_set1_hkdf_key(pctx, secret, hashlen) <= 0
-            || EVP_PKEY_CTX_add1_hkdf_info(pctx, hkdflabel, hkdflabellen) <= 0
-            || EVP_PKEY_derive(pctx, out, &outlen) <= 0;
-
-    EVP_PKEY_CTX_free(pctx);
-
-    if (ret != 0) {
-        if (fatal)
-            SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_HKDF_EXPAND,
-                     ERR_R_INTERNAL_ERROR);
-        else
-            SSLerr(SSL_F_TLS13_HKDF_EXPAND, ERR_R_INTERNAL_ERROR);
-    }
-
-    return ret == 0;
+    return 1;
 }
 
 /*
@@ -171,7 +225,7 @@ int tls13_generate_secret(SSL *s, const EVP_MD *md,
     size_t mdlen, prevsecretlen;
     int mdleni;
     int ret;
-    EVP_PKEY_CTX *pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, NULL);
+    HMAC_CTX *hmac;
 #ifdef CHARSET_EBCDIC
     static const char derived_secret_label[] = { 0x64, 0x65, 0x72, 0x69, 0x76, 0x65, 0x64, 0x00 };
 #else
@@ -179,12 +233,6 @@ int tls13_generate_secret(SSL *s, const EVP_MD *md,
 #endif
     unsigned char preextractsec[EVP_MAX_MD_SIZE];
 
-    if (pctx == NULL) {
-        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_GENERATE_SECRET,
-                 ERR_R_INTERNAL_ERROR);
-        return 0;
-    }
-
     mdleni = EVP_MD_size(md);
     /* Ensure cast to size_t is safe */
     if (!ossl_assert(mdleni >= 0)) {
@@ -212,7 +260,6 @@ int tls13_generate_secret(SSL *s, const EVP_MD *md,
             SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_GENERATE_SECRET,
                      ERR_R_INTERNAL_ERROR);
             EVP_MD_CTX_free(mctx);
-            EVP_PKEY_CTX_free(pctx);
             return 0;
         }
         EVP_MD_CTX_free(mctx);
@@ -223,7 +270,6 @@ int tls13_generate_secret(SSL *s, const EVP_MD *md,
                                sizeof(derived_secret_label) - 1, hash, mdlen,
                                preextractsec, mdlen, 1)) {
             /* SSLfatal() already called */
-            EVP_PKEY_CTX_free(pctx);
             return 0;
         }
 
@@ -231,21 +277,15 @@ int tls13_generate_secret(SSL *s, const EVP_MD *md,
         prevsecretlen = mdlen;
     }
 
-    ret = EVP_PKEY_derive_init(pctx) <= 0
-            || EVP_PKEY_CTX_hkdf_mode(pctx, EVP_PKEY_HKDEF_MODE_EXTRACT_ONLY)
-               <= 0
-            || EVP_PKEY_CTX_set_hkdf_md(pctx, md) <= 0
-            || EVP_PKEY_CTX_set1_hkdf_key(pctx, insecret, insecretlen) <= 0
-            || EVP_PKEY_CTX_set1_hkdf_salt(pctx, prevsecret, prevsecretlen)
-               <= 0
-            || EVP_PKEY_derive(pctx, outsecret, &mdlen)
-               <= 0;
+    /* HKDF-Extract: the new secret is HMAC(prevsecret, insecret) */
+    ret = (hmac = tls13_hmac_init(s, md, prevsecret, prevsecretlen)) == NULL
+            || !HMAC_Update(hmac, insecret, insecretlen)
+            || !HMAC_Final(hmac, outsecret, NULL);
 
     if (ret != 0)
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_GENERATE_SECRET,
                  ERR_R_INTERNAL_ERROR);
 
-    EVP_PKEY_CTX_free(pctx);
     if (prevsecret == preextractsec)
         OPENSSL_cleanse(preextractsec, mdlen);
     return ret == 0;
@@ -290,9 +330,10 @@ size_t tls13_final_finish_mac(SSL *s, const char *str, size_t slen,
 {
     const EVP_MD *md = ssl_handshake_md(s);
     unsigned char hash[EVP_MAX_MD_SIZE];
+    unsigned char finsecret[EVP_MAX_MD_SIZE];
+    const unsigned char *key;
     size_t hashlen, ret = 0;
-    EVP_PKEY *key = NULL;
-    EVP_MD_CTX *ctx = EVP_MD_CTX_new();
+    HMAC_CTX *hmac;
 
     if (!ssl_handshake_hash(s, hash, sizeof(hash), &hashlen)) {
         /* SSLfatal() already called */
@@ -300,29 +341,20 @@ size_t tls13_final_finish_mac(SSL *s, const char *str, size_t slen,
     }
 
     if (str == s->method->ssl3_enc->server_finished_label) {
-        key = EVP_PKEY_new_raw_private_key(EVP_PKEY_HMAC, NULL,
-                                           s->server_finished_secret, hashlen);
+        key = s->server_finished_secret;
     } else if (SSL_IS_FIRST_HANDSHAKE(s)) {
-        key = EVP_PKEY_new_raw_private_key(EVP_PKEY_HMAC, NULL,
-                                           s->client_finished_secret, hashlen);
+        key = s->client_finished_secret;
     } else {
-        unsigned char finsecret[EVP_MAX_MD_SIZE];
-
         if (!tls13_derive_finishedkey(s, ssl_handshake_md(s),
                                       s->client_app_traffic_secret,
                                       finsecret, hashlen))
             goto err;
-
-        key = EVP_PKEY_new_raw_private_key(EVP_PKEY_HMAC, NULL, finsecret,
-                                           hashlen);
-        OPENSSL_cleanse(finsecret, sizeof(finsecret));
+        key = finsecret;
     }
 
-    if (key == NULL
-            || ctx == NULL
-            || EVP_DigestSignInit(ctx, NULL, md, NULL, key) <= 0
-            || EVP_DigestSignUpdate(ctx, hash, hashlen) <= 0
-            || EVP_DigestSignFinal(ctx, out, &hashlen) <= 0) {
+    if ((hmac = tls13_hmac_init(s, md, key, hashlen)) == NULL
+            || !HMAC_Update(hmac, hash, hashlen)
+            || !HMAC_Final(hmac, out, NULL)) {
         SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_FINAL_FINISH_MAC,
                  ERR_R_INTERNAL_ERROR);
         goto err;
@@ -330,8 +362,7 @@ size_t tls13_final_finish_mac(SSL *s, const char *str, size_t slen,
 
     ret = hashlen;
  err:
-    EVP_PKEY_free(key);
-    EVP_MD_CTX_free(ctx);
+    OPENSSL_cleanse(finsecret, sizeof(finsecret));
     return ret;
 }
 
@@ -363,9 +394,9 @@ static int derive_secret_key_and_iv(SSL *s, int sending, const EVP_MD *md,
                                     const unsigned char *hash,
                                     const unsigned char *label,
                                     size_t labellen, unsigned char *secret,
-                                    unsigned char *iv, EVP_CIPHER_CTX *ciph_ctx)
+                                    unsigned char *key, unsigned char *iv,
+                                    EVP_CIPHER_CTX *ciph_ctx)
 {
-    unsigned char key[EVP_MAX_KEY_LENGTH];
     size_t ivlen, keylen, taglen;
     int hashleni = EVP_MD_size(md);
     size_t hashlen;
@@ -423,7 +454,7 @@ static int derive_secret_key_and_iv(SSL *s, int sending, const EVP_MD *md,
 
     return 1;
  err:
-    OPENSSL_cleanse(key, sizeof(key));
+    OPENSSL_cleanse(key, EVP_MAX_KEY_LENGTH);
     return 0;
 }
 
@@ -449,6 +480,7 @@ int tls13_change_cipher_state(SSL *s, int which)
     static const unsigned char early_exporter_master_secret[] = "e exp master";
 #endif
     unsigned char *iv;
+    unsigned char key[EVP_MAX_KEY_LENGTH];
     unsigned char secret[EVP_MAX_MD_SIZE];
     unsigned char hashval[EVP_MAX_MD_SIZE];
     unsigned char *hash = hashval;
@@ -632,7 +664,11 @@ int tls13_change_cipher_state(SSL *s, int which)
     if (!(which & SSL3_CC_EARLY)) {
         md = ssl_handshake_md(s);
         cipher = s->s3->tmp.new_sym_enc;
-        if (!ssl3_digest_cached_records(s, 1)
+        /*
+         * Nothing after the ServerHello needs the raw handshake messages in
+         * TLSv1.3, so drop the buffered copy if we still have one.
+         */
+        if (!ssl3_digest_cached_records(s, 0)
                 || !ssl_handshake_hash(s, hashval, sizeof(hashval), &hashlen)) {
             /* SSLfatal() already called */;
             goto err;
@@ -665,8 +701,8 @@ int tls13_change_cipher_state(SSL *s, int which)
     }
 
     if (!derive_secret_key_and_iv(s, which & SSL3_CC_WRITE, md, cipher,
-                                  insecret, hash, label, labellen, secret, iv,
-                                  ciph_ctx)) {
+                                  insecret, hash, label, labellen, secret, key,
+                                  iv, ciph_ctx)) {
         /* SSLfatal() already called */
         goto err;
     }
@@ -707,8 +743,16 @@ int tls13_change_cipher_state(SSL *s, int which)
         s->statem.enc_write_state = ENC_WRITE_STATE_WRITE_PLAIN_ALERTS;
     else
         s->statem.enc_write_state = ENC_WRITE_STATE_VALID;
+#ifndef OPENSSL_NO_KTLS
+    /* Only the application traffic keys are handed to the kernel */
+    if ((which & SSL3_CC_APPLICATION) != 0)
+        ssl_ktls_start(s, (which & SSL3_CC_WRITE) != 0, cipher, key,
+                       EVP_CIPHER_key_length(cipher), iv,
+                       EVP_CIPHER_CTX_iv_length(ciph_ctx));
+#endif
     ret = 1;
  err:
+    OPENSSL_cleanse(key, sizeof(key));
     OPENSSL_cleanse(secret, sizeof(secret));
     return ret;
 }
@@ -723,9 +767,14 @@ int tls13_update_key(SSL *s, int sending)
     const EVP_MD *md = ssl_handshake_md(s);
     size_t hashlen = EVP_MD_size(md);
     unsigned char *insecret, *iv;
+    unsigned char key[EVP_MAX_KEY_LENGTH];
     unsigned char secret[EVP_MAX_MD_SIZE];
     EVP_CIPHER_CTX *ciph_ctx;
     int ret = 0;
+#ifndef OPENSSL_NO_KTLS
+    int offloaded = sending ? BIO_get_ktls_send(s->wbio)
+                            : BIO_get_ktls_recv(s->rbio);
+#endif
 
     if (s->server == sending)
         insecret = s->server_app_traffic_secret;
@@ -746,17 +795,33 @@ int tls13_update_key(SSL *s, int sending)
     if (!derive_secret_key_and_iv(s, sending, ssl_handshake_md(s),
                                   s->s3->tmp.new_sym_enc, insecret, NULL,
                                   application_traffic,
-                                  sizeof(application_traffic) - 1, secret, iv,
-                                  ciph_ctx)) {
+                                  sizeof(application_traffic) - 1, secret, key,
+                                  iv, ciph_ctx)) {
         /* SSLfatal() already called */
         goto err;
     }
 
+#ifndef OPENSSL_NO_KTLS
+    /*
+     * Once a direction has been offloaded every later record is protected by
+     * the kernel, so the new keys must reach it or the connection is dead.
+     */
+    if (offloaded
+            && !ssl_ktls_start(s, sending, s->s3->tmp.new_sym_enc, key,
+                               EVP_CIPHER_key_length(s->s3->tmp.new_sym_enc),
+                               iv, EVP_CIPHER_CTX_iv_length(ciph_ctx))) {
+        SSLfatal(s, SSL_AD_INTERNAL_ERROR, SSL_F_TLS13_UPDATE_KEY,
+                 SSL_R_KTLS_REKEY_FAILED);
+        goto err;
+    }
+#endif
+
     memcpy(insecret, secret, hashlen);
 
     s->statem.enc_write_state = ENC_WRITE_STATE_VALID;
     ret = 1;
  err:
+    OPENSSL_cleanse(key, sizeof(key));
     OPENSSL_cleanse(secret, sizeof(secret));
     return ret;
 }
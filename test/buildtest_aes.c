@@ -0,0 +1,16 @@
+/*
+ * Generated with test/generate_buildtest.pl, to check that such a simple
+ * program builds.
+ */
+#include <openssl/opensslconf.h>
+#ifndef OPENSSL_NO_STDIO
+# include <stdio.h>
+#endif
+#ifndef OPENSSL_NO_AES
+# include <openssl/aes.h>
+#endif
+
+int main(void)
+{
+    return 0;
+}
@@ -371,6 +371,108 @@ static int test_reuse_crl(void)
     return 1;
 }
 
+/* Add a revoked entry with serial number |serial| to |crl| */
+static int add_revoked(X509_CRL *crl, long serial)
+{
+    X509_REVOKED *rev = X509_REVOKED_new();
+    ASN1_INTEGER *num = ASN1_INTEGER_new();
+    int ret = 0;
+
+    if (TEST_ptr(rev)
+            && TEST_ptr(num)
+            && TEST_true(ASN1_INTEGER_set(num, serial))
+            && TEST_true(X509_REVOKED_set_serialNumber(rev, num))
+            && TEST_true(X509_CRL_add0_revoked(crl, rev))) {
+        rev = NULL;
+        ret = 1;
+    }
+    X509_REVOKED_free(rev);
+    ASN1_INTEGER_free(num);
+    return ret;
+}
+
+/* Look up |serial| in |crl|, returning the entry found or NULL */
+static X509_REVOKED *lookup_revoked(X509_CRL *crl, long serial)
+{
+    ASN1_INTEGER *num = ASN1_INTEGER_new();
+    X509_REVOKED *rev = NULL;
+
+    if (TEST_ptr(num) && TEST_true(ASN1_INTEGER_set(num, serial))
+            && X509_CRL_get0_by_serial(crl, &rev, num) != 1)
+        rev = NULL;
+    ASN1_INTEGER_free(num);
+    return rev;
+}
+
+static int test_crl_serial_lookup(void)
+{
+    X509_CRL *crl = X509_CRL_new(), *other = NULL;
+    STACK_OF(X509_REVOKED) *revoked;
+    X509_REVOKED *rev;
+    long i;
+    int r = 0;
+
+    if (!TEST_ptr(crl))
+        return 0;
+
+    /* Added in descending order, including a negative serial number */
+    for (i = 1000; i >= -1; i--)
+        if (!add_revoked(crl, i * 3))
+            goto err;
+
+    for (i = 1000; i >= -1; i--)
+        if (!TEST_ptr(rev = lookup_revoked(crl, i * 3))
+                || !TEST_long_eq(ASN1_INTEGER_get(
+                                     X509_REVOKED_get0_serialNumber(rev)),
+                                 i * 3))
+            goto err;
+    if (!TEST_ptr_null(lookup_revoked(crl, 1))
+            || !TEST_ptr_null(lookup_revoked(crl, -1))
+            || !TEST_ptr_null(lookup_revoked(crl, 3003)))
+        goto err;
+
+    /* Lookups leave the entries in the order they were added */
+    revoked = X509_CRL_get_REVOKED(crl);
+    if (!TEST_long_eq(ASN1_INTEGER_get(X509_REVOKED_get0_serialNumber(
+                          sk_X509_REVOKED_value(revoked, 0))), 3000))
+        goto err;
+
+    /* An entry added after a lookup is found as well */
+    if (!add_revoked(crl, 1)
+            || !TEST_ptr(lookup_revoked(crl, 1))
+            || !TEST_ptr(lookup_revoked(crl, 3000)))
+        goto err;
+
+    /*
+     * So are entries that replace others in the stack directly, even though
+     * the number of entries stays the same
+     */
+    rev = sk_X509_REVOKED_delete(revoked, 0);
+    X509_REVOKED_free(rev);
+    if (!TEST_ptr(other = X509_CRL_new())
+            || !add_revoked(other, 5)
+            || !add_revoked(other, 7)
+            || !TEST_true(sk_X509_REVOKED_insert(revoked,
+                              sk_X509_REVOKED_shift(X509_CRL_get_REVOKED(other)),
+                              0)))
+        goto err;
+    rev = sk_X509_REVOKED_value(revoked, 1);
+    (void)sk_X509_REVOKED_set(revoked, 1,
+                              sk_X509_REVOKED_shift(X509_CRL_get_REVOKED(other)));
+    X509_REVOKED_free(rev);
+    if (!TEST_ptr_null(lookup_revoked(crl, 3000))
+            || !TEST_ptr_null(lookup_revoked(crl, 2997))
+            || !TEST_ptr(lookup_revoked(crl, 5))
+            || !TEST_ptr(lookup_revoked(crl, 7)))
+        goto err;
+
+    r = 1;
+ err:
+    X509_CRL_free(other);
+    X509_CRL_free(crl);
+    return r;
+}
+
 int setup_tests(void)
 {
     if (!TEST_ptr(test_root = X509_from_strings(kCRLTestRoot))
@@ -383,6 +485,7 @@ int setup_tests(void)
     ADD_TEST(test_known_critical_crl);
     ADD_ALL_TESTS(test_unknown_critical_crl, OSSL_NELEM(unknown_critical_crls));
     ADD_TEST(test_reuse_crl);
+    ADD_TEST(test_crl_serial_lookup);
     return 1;
 }
 
@@ -328,6 +328,167 @@ static int test_dtls_duplicate_records(void)
     return testresult;
 }
 
+/*
+ * Deliver every flight in reverse order and in many small records, so that
+ * the handshake messages, their fragments and the records of the next epoch
+ * all have to be queued before they can be processed.
+ */
+static int test_dtls_reordered_flights(int idx)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *serverssl = NULL, *clientssl = NULL;
+    int testresult = 0;
+    unsigned char buf[64];
+    size_t written, readbytes;
+
+    if (!TEST_true(create_ssl_ctx_pair(DTLS_server_method(),
+                                       DTLS_client_method(),
+                                       DTLS1_VERSION, DTLS_MAX_VERSION,
+                                       &sctx, &cctx, cert, privkey)))
+        return 0;
+
+    if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                      NULL, NULL)))
+        goto end;
+
+    DTLS_set_timer_cb(clientssl, timer_cb);
+    DTLS_set_timer_cb(serverssl, timer_cb);
+
+    /* Each test uses a smaller MTU, and so more fragments */
+    SSL_set_options(clientssl, SSL_OP_NO_QUERY_MTU);
+    SSL_set_options(serverssl, SSL_OP_NO_QUERY_MTU);
+    if (!TEST_true(SSL_set_mtu(clientssl, 1024 >> idx))
+            || !TEST_true(SSL_set_mtu(serverssl, 1024 >> idx)))
+        goto end;
+
+    BIO_ctrl(SSL_get_wbio(clientssl), MEMPACKET_CTRL_SET_REORDER, 1, NULL);
+    BIO_ctrl(SSL_get_wbio(serverssl), MEMPACKET_CTRL_SET_REORDER, 1, NULL);
+
+    if (!TEST_true(create_ssl_connection(serverssl, clientssl, SSL_ERROR_NONE))
+            || !TEST_true(SSL_write_ex(clientssl, "hello", 5, &written))
+            || !TEST_true(SSL_read_ex(serverssl, buf, sizeof(buf),
+                                      &readbytes))
+            || !TEST_mem_eq(buf, readbytes, "hello", 5))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+#if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
+/*
+ * Run a DTLS connection over loopback UDP sockets whose datagram BIOs batch
+ * their I/O, so that whole flights and bursts of records are received and
+ * sent with a single syscall.
+ */
+#define BATCH_RECORDS   20
+
+static int test_dtls_batched_io(void)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *serverssl = NULL, *clientssl = NULL;
+    BIO *sbio = NULL, *cbio = NULL;
+    BIO_ADDR *saddr = NULL, *caddr = NULL;
+    union BIO_sock_info_u info;
+    int sfd = -1, cfd = -1, testresult = 0, i, ret;
+    unsigned char buf[16];
+    size_t written, readbytes;
+
+    if (!TEST_true(create_test_dgram_sockets(&cfd, &sfd))
+            || !TEST_ptr(saddr = BIO_ADDR_new())
+            || !TEST_ptr(caddr = BIO_ADDR_new()))
+        goto end;
+    info.addr = saddr;
+    if (!TEST_true(BIO_sock_info(sfd, BIO_SOCK_INFO_ADDRESS, &info)))
+        goto end;
+    info.addr = caddr;
+    if (!TEST_true(BIO_sock_info(cfd, BIO_SOCK_INFO_ADDRESS, &info))
+            || !TEST_ptr(sbio = BIO_new_dgram(sfd, BIO_CLOSE)))
+        goto end;
+    sfd = -1;
+    if (!TEST_ptr(cbio = BIO_new_dgram(cfd, BIO_CLOSE)))
+        goto end;
+    cfd = -1;
+    (void)BIO_ctrl_set_connected(sbio, caddr);
+    (void)BIO_ctrl_set_connected(cbio, saddr);
+
+    if (!BIO_dgram_set_batch(sbio, 8)) {
+        TEST_info("Batched datagram I/O is not supported, skipping");
+        testresult = 1;
+        goto end;
+    }
+    if (!TEST_true(BIO_dgram_set_batch(cbio, 8))
+            || !TEST_int_eq(BIO_dgram_get_batch(cbio), 8))
+        goto end;
+
+    if (!TEST_true(create_ssl_ctx_pair(DTLS_server_method(),
+                                       DTLS_client_method(),
+                                       DTLS1_VERSION, DTLS_MAX_VERSION,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_ptr(serverssl = SSL_new(sctx))
+            || !TEST_ptr(clientssl = SSL_new(cctx)))
+        goto end;
+    SSL_set_bio(serverssl, sbio, sbio);
+    SSL_set_bio(clientssl, cbio, cbio);
+    sbio = cbio = NULL;
+    DTLS_set_timer_cb(clientssl, timer_cb);
+    DTLS_set_timer_cb(serverssl, timer_cb);
+
+    if (!TEST_true(create_ssl_connection(serverssl, clientssl,
+                                         SSL_ERROR_NONE)))
+        goto end;
+
+    /* Each record is queued, and the queue goes out when full or flushed */
+    for (i = 0; i < BATCH_RECORDS; i++) {
+        buf[0] = (unsigned char)i;
+        if (!TEST_true(SSL_write_ex(clientssl, buf, 1, &written)))
+            goto end;
+    }
+    if (!TEST_int_eq(BIO_flush(SSL_get_wbio(clientssl)), 1))
+        goto end;
+
+    for (i = 0; i < BATCH_RECORDS; ) {
+        ret = SSL_read_ex(serverssl, buf, sizeof(buf), &readbytes);
+        if (!ret) {
+            if (!TEST_int_eq(SSL_get_error(serverssl, ret),
+                             SSL_ERROR_WANT_READ))
+                goto end;
+            continue;
+        }
+        if (!TEST_size_t_eq(readbytes, 1)
+                || !TEST_int_eq(buf[0], i))
+            goto end;
+        /* The rest of a batch waits in the BIO rather than the socket */
+        if (i == 0 && !TEST_true(SSL_has_pending(serverssl)))
+            goto end;
+        i++;
+    }
+
+    testresult = 1;
+ end:
+    if (sfd >= 0)
+        BIO_closesocket(sfd);
+    if (cfd >= 0)
+        BIO_closesocket(cfd);
+    BIO_free(sbio);
+    BIO_free(cbio);
+    BIO_ADDR_free(saddr);
+    BIO_ADDR_free(caddr);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+#endif
+
 int setup_tests(void)
 {
     if (!TEST_ptr(cert = test_get_argument(0))
@@ -338,6 +499,10 @@ int setup_tests(void)
     ADD_ALL_TESTS(test_dtls_drop_records, TOTAL_RECORDS);
     ADD_TEST(test_cookie);
     ADD_TEST(test_dtls_duplicate_records);
+    ADD_ALL_TESTS(test_dtls_reordered_flights, 3);
+#if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
+    ADD_TEST(test_dtls_batched_io);
+#endif
 
     return 1;
 }
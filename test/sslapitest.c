@@ -17,13 +17,21 @@
 #include <openssl/srp.h>
 #include <openssl/txt_db.h>
 #include <openssl/aes.h>
+#include <openssl/rand.h>
 
 #include "ssltestlib.h"
 #include "testutil.h"
 #include "testutil/output.h"
 #include "internal/nelem.h"
+#include "internal/ktls.h"
 #include "../ssl/ssl_local.h"
 
+#if defined(OPENSSL_SYS_UNIX)
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
 #ifndef OPENSSL_NO_TLS1_3
 
 static SSL_SESSION *clientpsk = NULL;
@@ -685,6 +693,248 @@ static int test_large_message_dtls(void)
 }
 #endif
 
+#if !defined(OPENSSL_NO_KTLS) && !defined(OPENSSL_NO_SOCK)
+/* sock must be connected */
+static int ktls_chk_platform(int sock)
+{
+    return ktls_enable(sock);
+}
+
+/*
+ * Receive offload needs a newer kernel than transmit offload. Find out
+ * whether we have one by handing a connection of our own with an all zero
+ * AES-128-GCM key for |tlsver| to the kernel.
+ */
+static int ktls_chk_platform_rx(int tlsver)
+{
+    ktls_crypto_info_t crypto_info;
+    int cfd = -1, sfd = -1, ret;
+
+    if (!create_test_sockets(&cfd, &sfd))
+        return 0;
+
+    memset(&crypto_info, 0, sizeof(crypto_info));
+    crypto_info.u.gcm128.info.version = tlsver;
+    crypto_info.u.gcm128.info.cipher_type = TLS_CIPHER_AES_GCM_128;
+    crypto_info.tls_len = sizeof(crypto_info.u.gcm128);
+    ret = ktls_start(cfd, &crypto_info, 0);
+
+    BIO_closesocket(cfd);
+    BIO_closesocket(sfd);
+    return ret;
+}
+
+/* Write |msg| on |writer| and read it back on |reader| */
+static int ktls_write_read(SSL *writer, SSL *reader, const char *msg)
+{
+    char buf[128];
+    size_t msglen = strlen(msg), written = 0, readbytes = 0;
+
+    return TEST_true(SSL_write_ex(writer, msg, msglen, &written))
+           && TEST_size_t_eq(written, msglen)
+           && TEST_true(SSL_read_ex(reader, buf, sizeof(buf), &readbytes))
+           && TEST_mem_eq(buf, readbytes, msg, msglen);
+}
+
+/*
+ * Test Kernel TLS offload:
+ * Test 0-3: TLSv1.2, kTLS requested by neither side, client, server, both
+ * Test 4-7: TLSv1.3, kTLS requested by neither side, client, server, both
+ * When the kernel lacks TLS support we check that the connection silently
+ * falls back to the normal record layer.
+ */
+static int test_ktls(int test)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0, cfd = -1, sfd = -1, tlsver, platform = 0, rx = 0;
+    int cis_ktls = (test & 1) != 0, sis_ktls = (test & 2) != 0;
+
+    if (test < 4) {
+#ifdef OPENSSL_NO_TLS1_2
+        return 1;
+#else
+        tlsver = TLS1_2_VERSION;
+#endif
+    } else {
+#ifdef OPENSSL_NO_TLS1_3
+        return 1;
+#else
+        tlsver = TLS1_3_VERSION;
+#endif
+    }
+
+    if (!TEST_true(create_test_sockets(&cfd, &sfd)))
+        goto end;
+
+    /*
+     * Only attach the tls module to a socket that asks for kTLS, so that the
+     * other variants run over plain sockets
+     */
+    if (cis_ktls || sis_ktls) {
+        platform = ktls_chk_platform(cis_ktls ? cfd : sfd);
+        rx = platform && ktls_chk_platform_rx(tlsver);
+    }
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), tlsver, tlsver,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_cipher_list(cctx, "AESGCM"))
+            || !TEST_true(SSL_CTX_set_ciphersuites(cctx,
+                                                   "TLS_AES_128_GCM_SHA256")))
+        goto end;
+
+    if (cis_ktls)
+        SSL_CTX_set_options(cctx, SSL_OP_ENABLE_KTLS);
+    if (sis_ktls)
+        SSL_CTX_set_options(sctx, SSL_OP_ENABLE_KTLS);
+
+    if (!TEST_true(create_ssl_objects2(sctx, cctx, &serverssl, &clientssl,
+                                       sfd, cfd))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+
+    /* Both ends are now driven one at a time so blocking IO is fine */
+    if (!TEST_true(BIO_socket_nbio(cfd, 0))
+            || !TEST_true(BIO_socket_nbio(sfd, 0)))
+        goto end;
+
+    /*
+     * Transmit offload is available wherever the kernel has the tls module,
+     * receive offload wherever it also accepts receive keys.
+     */
+    if (!TEST_int_eq(BIO_get_ktls_send(SSL_get_wbio(clientssl)),
+                     cis_ktls && platform)
+            || !TEST_int_eq(BIO_get_ktls_send(SSL_get_wbio(serverssl)),
+                            sis_ktls && platform)
+            || !TEST_int_eq(BIO_get_ktls_recv(SSL_get_rbio(clientssl)),
+                            cis_ktls && rx)
+            || !TEST_int_eq(BIO_get_ktls_recv(SSL_get_rbio(serverssl)),
+                            sis_ktls && rx))
+        goto end;
+
+    if (!TEST_true(ktls_write_read(clientssl, serverssl, "Hello from client"))
+            || !TEST_true(ktls_write_read(serverssl, clientssl,
+                                          "Hello from server"))
+            || !TEST_true(ktls_write_read(clientssl, serverssl, "Goodbye")))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    if (cfd != -1)
+        BIO_closesocket(cfd);
+    if (sfd != -1)
+        BIO_closesocket(sfd);
+    return testresult;
+}
+
+#define SENDFILE_SZ                     (16 * 4096)
+#define SENDFILE_CHUNK                  (4 * 4096)
+
+/*
+ * Test SSL_sendfile(): it must send the file contents when the client's
+ * transmit side is offloaded, and fail cleanly when it is not.
+ */
+static int test_ktls_sendfile(int tls13)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    unsigned char *buf = NULL, *buf_dst = NULL;
+    FILE *fp = NULL;
+    int testresult = 0, cfd = -1, sfd = -1, platform, tlsver;
+    off_t chunk_off = 0;
+    size_t readbytes;
+
+#ifdef OPENSSL_NO_TLS1_3
+    if (tls13)
+        return 1;
+#endif
+#ifdef OPENSSL_NO_TLS1_2
+    if (!tls13)
+        return 1;
+#endif
+    tlsver = tls13 ? TLS1_3_VERSION : TLS1_2_VERSION;
+
+    if (!TEST_ptr(buf = OPENSSL_malloc(SENDFILE_SZ))
+            || !TEST_ptr(buf_dst = OPENSSL_malloc(SENDFILE_SZ))
+            || !TEST_true(RAND_bytes(buf, SENDFILE_SZ))
+            || !TEST_ptr(fp = tmpfile())
+            || !TEST_size_t_eq(fwrite(buf, 1, SENDFILE_SZ, fp), SENDFILE_SZ)
+            || !TEST_int_eq(fflush(fp), 0))
+        goto end;
+
+    if (!TEST_true(create_test_sockets(&cfd, &sfd)))
+        goto end;
+
+    platform = ktls_chk_platform(cfd);
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), tlsver, tlsver,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_cipher_list(cctx, "AESGCM"))
+            || !TEST_true(SSL_CTX_set_ciphersuites(cctx,
+                                                   "TLS_AES_128_GCM_SHA256")))
+        goto end;
+
+    SSL_CTX_set_options(cctx, SSL_OP_ENABLE_KTLS);
+
+    if (!TEST_true(create_ssl_objects2(sctx, cctx, &serverssl, &clientssl,
+                                       sfd, cfd))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(BIO_socket_nbio(cfd, 0))
+            || !TEST_true(BIO_socket_nbio(sfd, 0)))
+        goto end;
+
+    if (!platform || !BIO_get_ktls_send(SSL_get_wbio(clientssl))) {
+        testresult = TEST_int_lt(SSL_sendfile(clientssl, fileno(fp), 0,
+                                              SENDFILE_SZ, 0), 0)
+                     && TEST_int_eq(ERR_GET_REASON(ERR_get_error()),
+                                    SSL_R_KTLS_SEND_NOT_ENABLED);
+        goto end;
+    }
+
+    while (chunk_off < SENDFILE_SZ) {
+        ossl_ssize_t sent = SSL_sendfile(clientssl, fileno(fp), chunk_off,
+                                         SENDFILE_CHUNK, 0);
+
+        if (!TEST_int_gt(sent, 0))
+            goto end;
+        while (sent > 0) {
+            if (!TEST_true(SSL_read_ex(serverssl, buf_dst + chunk_off,
+                                       SENDFILE_SZ - chunk_off, &readbytes)))
+                goto end;
+            chunk_off += readbytes;
+            sent -= readbytes;
+        }
+    }
+
+    if (!TEST_mem_eq(buf_dst, SENDFILE_SZ, buf, SENDFILE_SZ))
+        goto end;
+
+    testresult = 1;
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    if (cfd != -1)
+        BIO_closesocket(cfd);
+    if (sfd != -1)
+        BIO_closesocket(sfd);
+    if (fp != NULL)
+        fclose(fp);
+    OPENSSL_free(buf);
+    OPENSSL_free(buf_dst);
+    return testresult;
+}
+#endif
+
 #ifndef OPENSSL_NO_OCSP
 static int ocsp_server_cb(SSL *s, void *arg)
 {
@@ -892,7 +1142,7 @@ static SSL_SESSION *get_session_cb(SSL *ssl, const unsigned char *id, int len,
 }
 
 static int execute_test_session(int maxprot, int use_int_cache,
-                                int use_ext_cache)
+                                int use_ext_cache, long sharded)
 {
     SSL_CTX *sctx = NULL, *cctx = NULL;
     SSL *serverssl1 = NULL, *clientssl1 = NULL;
@@ -928,11 +1178,12 @@ static int execute_test_session(int maxprot, int use_int_cache,
     }
     if (use_int_cache) {
         /* Also covers instance where both are set */
-        SSL_CTX_set_session_cache_mode(cctx, SSL_SESS_CACHE_CLIENT);
+        SSL_CTX_set_session_cache_mode(cctx, SSL_SESS_CACHE_CLIENT | sharded);
     } else {
         SSL_CTX_set_session_cache_mode(cctx,
                                        SSL_SESS_CACHE_CLIENT
-                                       | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+                                       | SSL_SESS_CACHE_NO_INTERNAL_STORE
+                                       | sharded);
     }
 
     if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl1, &clientssl1,
@@ -1068,7 +1319,10 @@ static int execute_test_session(int maxprot, int use_int_cache,
     if (!use_int_cache)
         SSL_CTX_set_session_cache_mode(sctx,
                                        SSL_SESS_CACHE_SERVER
-                                       | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+                                       | SSL_SESS_CACHE_NO_INTERNAL_STORE
+                                       | sharded);
+    else if (sharded)
+        SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER | sharded);
 
     SSL_free(serverssl1);
     SSL_free(clientssl1);
@@ -1174,17 +1428,260 @@ static int execute_test_session(int maxprot, int use_int_cache,
 
     return testresult;
 }
+
+/*
+ * Test that the sharded internal session cache keeps to the cache size limit,
+ * that switching between sharded and unsharded mode empties the cache and
+ * that the mode can't be switched once the cache is in use.
+ */
+static int test_session_cache_sharded_limit(void)
+{
+    SSL_CTX *ctx = NULL;
+    SSL *ssl = NULL;
+    SSL_SESSION *sess = NULL;
+    unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    int i, testresult = 0;
+
+    if (!TEST_ptr(ctx = SSL_CTX_new(TLS_server_method())))
+        goto end;
+
+    SSL_CTX_sess_set_remove_cb(ctx, remove_session_cb);
+    SSL_CTX_sess_set_cache_size(ctx, 64);
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER
+                                        | SSL_SESS_CACHE_SHARDED);
+    if (!TEST_long_eq(SSL_CTX_get_session_cache_mode(ctx),
+                      SSL_SESS_CACHE_SERVER | SSL_SESS_CACHE_SHARDED))
+        goto end;
+
+    remove_called = 0;
+    for (i = 0; i < 1000; i++) {
+        if (!TEST_int_eq(RAND_bytes(id, sizeof(id)), 1)
+                || !TEST_ptr(sess = SSL_SESSION_new())
+                || !TEST_true(SSL_SESSION_set1_id(sess, id, sizeof(id)))
+                || !TEST_true(SSL_CTX_add_session(ctx, sess))
+                /* Adding it a second time finds it in the cache */
+                || !TEST_false(SSL_CTX_add_session(ctx, sess))
+                || !TEST_long_le(SSL_CTX_sess_number(ctx), 64))
+            goto end;
+        SSL_SESSION_free(sess);
+        sess = NULL;
+    }
+    if (!TEST_int_eq(remove_called, 1000 - SSL_CTX_sess_number(ctx)))
+        goto end;
+
+    /* Sessions are not carried over from the sharded cache */
+    remove_called = 0;
+    i = (int)SSL_CTX_sess_number(ctx);
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER);
+    if (!TEST_long_eq(SSL_CTX_sess_number(ctx), 0)
+            || !TEST_int_eq(remove_called, i))
+        goto end;
+
+    /*
+     * Once an SSL has been created from it the sharding can no longer
+     * change, but the rest of the mode can
+     */
+    if (!TEST_ptr(ssl = SSL_new(ctx))
+            || !TEST_long_eq(SSL_CTX_set_session_cache_mode(
+                                 ctx, SSL_SESS_CACHE_SERVER
+                                      | SSL_SESS_CACHE_SHARDED), 0)
+            || !TEST_long_eq(SSL_CTX_get_session_cache_mode(ctx),
+                             SSL_SESS_CACHE_SERVER)
+            || !TEST_long_eq(SSL_CTX_set_session_cache_mode(
+                                 ctx, SSL_SESS_CACHE_BOTH),
+                             SSL_SESS_CACHE_SERVER)
+            || !TEST_long_eq(SSL_CTX_get_session_cache_mode(ctx),
+                             SSL_SESS_CACHE_BOTH))
+        goto end;
+    ERR_clear_error();
+
+    testresult = 1;
+
+ end:
+    SSL_free(ssl);
+    SSL_SESSION_free(sess);
+    SSL_CTX_free(ctx);
+    return testresult;
+}
+
+/*
+ * Test that flushing the internal session cache removes exactly the expired
+ * sessions, also after a cached session's time has been changed.
+ * Test 0: Unsharded cache
+ * Test 1: Sharded cache
+ */
+#define EXPIRY_TEST_SESSIONS 100
+static int test_session_cache_expiry(int idx)
+{
+    SSL_CTX *ctx = NULL;
+    SSL_SESSION *sess[EXPIRY_TEST_SESSIONS];
+    unsigned char id[SSL_MAX_SSL_SESSION_ID_LENGTH];
+    long now = (long)time(NULL);
+    int i, testresult = 0;
+
+    memset(sess, 0, sizeof(sess));
+    if (!TEST_ptr(ctx = SSL_CTX_new(TLS_server_method())))
+        goto end;
+
+    SSL_CTX_sess_set_remove_cb(ctx, remove_session_cb);
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_SERVER
+                                        | (idx == 1 ? SSL_SESS_CACHE_SHARDED
+                                                    : 0));
+
+    /* Add sessions with timeouts from 1 to 100 seconds in shuffled order */
+    for (i = 0; i < EXPIRY_TEST_SESSIONS; i++) {
+        if (!TEST_int_eq(RAND_bytes(id, sizeof(id)), 1)
+                || !TEST_ptr(sess[i] = SSL_SESSION_new())
+                || !TEST_true(SSL_SESSION_set1_id(sess[i], id, sizeof(id)))
+                || !TEST_true(SSL_SESSION_set_time(sess[i], now))
+                || !TEST_true(SSL_SESSION_set_timeout(sess[i],
+                                  (i * 37) % EXPIRY_TEST_SESSIONS + 1))
+                || !TEST_true(SSL_CTX_add_session(ctx, sess[i])))
+            goto end;
+    }
+
+    /* Only sessions with a timeout below 50 seconds have expired */
+    remove_called = 0;
+    SSL_CTX_flush_sessions(ctx, now + 50);
+    if (!TEST_int_eq(remove_called, 49)
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), 51))
+        goto end;
+    for (i = 0; i < EXPIRY_TEST_SESSIONS; i++) {
+        if (!TEST_int_eq(SSL_SESSION_is_resumable(sess[i]),
+                         SSL_SESSION_get_timeout(sess[i]) >= 50))
+            goto end;
+    }
+
+    /* Make one of the remaining sessions expire: i = 2 has a timeout of 75 */
+    if (!TEST_long_eq(SSL_SESSION_get_timeout(sess[2]), 75)
+            || !TEST_true(SSL_SESSION_set_time(sess[2], now - 100)))
+        goto end;
+    remove_called = 0;
+    SSL_CTX_flush_sessions(ctx, now + 50);
+    if (!TEST_int_eq(remove_called, 1)
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), 50)
+            || !TEST_false(SSL_CTX_remove_session(ctx, sess[2])))
+        goto end;
+
+    remove_called = 0;
+    SSL_CTX_flush_sessions(ctx, 0);
+    if (!TEST_int_eq(remove_called, 50)
+            || !TEST_long_eq(SSL_CTX_sess_number(ctx), 0))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    for (i = 0; i < EXPIRY_TEST_SESSIONS; i++)
+        SSL_SESSION_free(sess[i]);
+    SSL_CTX_free(ctx);
+    return testresult;
+}
+
+#if defined(OPENSSL_SYS_UNIX) && defined(OPENSSL_THREADS)
+/*
+ * Test that a session established in one process is resumed in another one
+ * through the shared session cache.
+ * Test 0: TLSv1.2
+ * Test 1: TLSv1.3 with stateful tickets
+ */
+static int test_shared_session_cache(int idx)
+{
+    SSL_CTX *sctx = NULL, *cctx = NULL;
+    SSL *serverssl = NULL, *clientssl = NULL;
+    SSL_SESSION *sess = NULL;
+    unsigned char buf[4096], *q;
+    const unsigned char *p;
+    int fds[2] = { -1, -1 };
+    int prot = idx == 0 ? TLS1_2_VERSION : TLS1_3_VERSION;
+    int len = 0, n, status = 0, testresult = 0;
+    pid_t pid;
+
+# ifdef OPENSSL_NO_TLS1_2
+    if (idx == 0)
+        return 1;
+# endif
+# ifdef OPENSSL_NO_TLS1_3
+    if (idx == 1)
+        return 1;
+# endif
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), prot, prot,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_shared_session_cache(sctx, 64, 0)))
+        goto end;
+    /* Only the shared cache can provide the session */
+    SSL_CTX_set_session_cache_mode(sctx, SSL_SESS_CACHE_SERVER
+                                         | SSL_SESS_CACHE_NO_INTERNAL);
+    SSL_CTX_set_options(sctx, SSL_OP_NO_TICKET);
+
+    if (!TEST_int_eq(pipe(fds), 0)
+            || !TEST_int_ge(pid = fork(), 0))
+        goto end;
+
+    if (pid == 0) {
+        /* I'm the child; do a full handshake and pass on the session */
+        status = 1;
+        close(fds[0]);
+        if (create_ssl_objects(sctx, cctx, &serverssl, &clientssl, NULL, NULL)
+                && create_ssl_connection(serverssl, clientssl, SSL_ERROR_NONE)
+                && (sess = SSL_get1_session(clientssl)) != NULL
+                && (len = i2d_SSL_SESSION(sess, NULL)) > 0
+                && len <= (int)sizeof(buf)) {
+            q = buf;
+            if (i2d_SSL_SESSION(sess, &q) == len
+                    && write(fds[1], buf, len) == len)
+                status = 0;
+        }
+        exit(status);
+    }
+
+    /* I'm the parent; resume the child's session */
+    close(fds[1]);
+    fds[1] = -1;
+    while (len < (int)sizeof(buf)
+           && (n = read(fds[0], buf + len, sizeof(buf) - len)) > 0)
+        len += n;
+    p = buf;
+    if (!TEST_int_eq(waitpid(pid, &status, 0), pid)
+            || !TEST_int_eq(status, 0)
+            || !TEST_ptr(sess = d2i_SSL_SESSION(NULL, &p, len))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(SSL_set_session(clientssl, sess))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(SSL_session_reused(clientssl))
+            || !TEST_long_eq(SSL_CTX_sess_cb_hits(sctx), 1))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    if (fds[0] >= 0)
+        close(fds[0]);
+    if (fds[1] >= 0)
+        close(fds[1]);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_SESSION_free(sess);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+#endif
 #endif /* !defined(OPENSSL_NO_TLS1_3) || !defined(OPENSSL_NO_TLS1_2) */
 
 static int test_session_with_only_int_cache(void)
 {
 #ifndef OPENSSL_NO_TLS1_3
-    if (!execute_test_session(TLS1_3_VERSION, 1, 0))
+    if (!execute_test_session(TLS1_3_VERSION, 1, 0, 0))
         return 0;
 #endif
 
 #ifndef OPENSSL_NO_TLS1_2
-    return execute_test_session(TLS1_2_VERSION, 1, 0);
+    return execute_test_session(TLS1_2_VERSION, 1, 0, 0);
 #else
     return 1;
 #endif
@@ -1193,12 +1690,12 @@ static int test_session_with_only_int_cache(void)
 static int test_session_with_only_ext_cache(void)
 {
 #ifndef OPENSSL_NO_TLS1_3
-    if (!execute_test_session(TLS1_3_VERSION, 0, 1))
+    if (!execute_test_session(TLS1_3_VERSION, 0, 1, 0))
         return 0;
 #endif
 
 #ifndef OPENSSL_NO_TLS1_2
-    return execute_test_session(TLS1_2_VERSION, 0, 1);
+    return execute_test_session(TLS1_2_VERSION, 0, 1, 0);
 #else
     return 1;
 #endif
@@ -1207,12 +1704,26 @@ static int test_session_with_only_ext_cache(void)
 static int test_session_with_both_cache(void)
 {
 #ifndef OPENSSL_NO_TLS1_3
-    if (!execute_test_session(TLS1_3_VERSION, 1, 1))
+    if (!execute_test_session(TLS1_3_VERSION, 1, 1, 0))
+        return 0;
+#endif
+
+#ifndef OPENSSL_NO_TLS1_2
+    return execute_test_session(TLS1_2_VERSION, 1, 1, 0);
+#else
+    return 1;
+#endif
+}
+
+static int test_session_with_sharded_cache(void)
+{
+#ifndef OPENSSL_NO_TLS1_3
+    if (!execute_test_session(TLS1_3_VERSION, 1, 1, SSL_SESS_CACHE_SHARDED))
         return 0;
 #endif
 
 #ifndef OPENSSL_NO_TLS1_2
-    return execute_test_session(TLS1_2_VERSION, 1, 1);
+    return execute_test_session(TLS1_2_VERSION, 1, 1, SSL_SESS_CACHE_SHARDED);
 #else
     return 1;
 #endif
@@ -5289,39 +5800,849 @@ static int test_ssl_pending(int tst)
     return testresult;
 }
 
-static struct {
-    unsigned int maxprot;
-    const char *clntciphers;
-    const char *clnttls13ciphers;
-    const char *srvrciphers;
-    const char *srvrtls13ciphers;
-    const char *shared;
-} shared_ciphers_data[] = {
+#ifndef OPENSSL_NO_TLS1_2
 /*
- * We can't establish a connection (even in TLSv1.1) with these ciphersuites if
- * TLSv1.3 is enabled but TLSv1.2 is disabled.
+ * Test that data written and read in pipelines of AEAD records arrives intact
+ * Test 0: AES-GCM
+ * Test 1: ChaCha20-Poly1305
  */
-#if defined(OPENSSL_NO_TLS1_3) || !defined(OPENSSL_NO_TLS1_2)
-    {
-        TLS1_2_VERSION,
-        "AES128-SHA:AES256-SHA",
-        NULL,
-        "AES256-SHA:DHE-RSA-AES128-SHA",
-        NULL,
-        "AES256-SHA"
-    },
-    {
-        TLS1_2_VERSION,
-        "AES128-SHA:DHE-RSA-AES128-SHA:AES256-SHA",
-        NULL,
-        "AES128-SHA:DHE-RSA-AES256-SHA:AES256-SHA",
-        NULL,
-        "AES128-SHA:AES256-SHA"
-    },
-    {
-        TLS1_2_VERSION,
-        "AES128-SHA:AES256-SHA",
-        NULL,
+static int test_pipelining(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0;
+    unsigned char msg[8000], buf[sizeof(msg)];
+    size_t written, readbytes, total = 0;
+    const char *cipher = (tst == 0) ? "AES128-GCM-SHA256"
+                                    : "ECDHE-RSA-CHACHA20-POLY1305";
+
+# ifdef OPENSSL_NO_CHACHA
+    if (tst == 1)
+        return 1;
+# endif
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(),
+                                       TLS1_2_VERSION, TLS1_2_VERSION,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_cipher_list(cctx, cipher))
+            || !TEST_true(SSL_CTX_set_max_pipelines(sctx, 4))
+            || !TEST_true(SSL_CTX_set_max_pipelines(cctx, 4))
+            || !TEST_true(SSL_CTX_set_split_send_fragment(cctx, 1024)))
+        goto end;
+
+    if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                      NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+
+    memset(msg, 'A', sizeof(msg));
+    if (!TEST_true(SSL_write_ex(clientssl, msg, sizeof(msg), &written))
+            || !TEST_size_t_eq(written, sizeof(msg)))
+        goto end;
+    while (total < sizeof(buf)) {
+        if (!TEST_true(SSL_read_ex(serverssl, buf + total, sizeof(buf) - total,
+                                   &readbytes)))
+            goto end;
+        total += readbytes;
+    }
+    if (!TEST_mem_eq(buf, total, msg, sizeof(msg)))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+#endif
+
+/*
+ * Test that large writes over AEAD ciphersuites, which are sent in batches of
+ * several records, arrive intact
+ * Test 0: TLSv1.2 AES-GCM
+ * Test 1: TLSv1.2 ChaCha20-Poly1305
+ * Test 2: TLSv1.3 AES-GCM
+ * Test 3: TLSv1.3 ChaCha20-Poly1305
+ */
+static int test_large_write(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0, tls13 = tst >= 2;
+    /* Enough for a batch of 8 records, then 4, then a few on their own */
+    size_t msglen = 15 * SSL3_RT_MAX_PLAIN_LENGTH + 1000;
+    unsigned char *msg = NULL, *buf = NULL;
+    size_t written, readbytes, total = 0, i;
+
+#ifdef OPENSSL_NO_TLS1_2
+    if (!tls13)
+        return 1;
+#endif
+#ifdef OPENSSL_NO_TLS1_3
+    if (tls13)
+        return 1;
+#endif
+#ifdef OPENSSL_NO_CHACHA
+    if (tst % 2 == 1)
+        return 1;
+#endif
+
+    if (!TEST_ptr(msg = OPENSSL_malloc(msglen))
+            || !TEST_ptr(buf = OPENSSL_malloc(msglen)))
+        goto end;
+    for (i = 0; i < msglen; i++)
+        msg[i] = (unsigned char)(i % 251);
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(),
+                                       tls13 ? TLS1_3_VERSION : TLS1_2_VERSION,
+                                       tls13 ? TLS1_3_VERSION : TLS1_2_VERSION,
+                                       &sctx, &cctx, cert, privkey)))
+        goto end;
+    if (tls13) {
+        if (!TEST_true(SSL_CTX_set_ciphersuites(cctx, tst == 2
+                                               ? "TLS_AES_128_GCM_SHA256"
+                                               : "TLS_CHACHA20_POLY1305_SHA256")))
+            goto end;
+    } else if (!TEST_true(SSL_CTX_set_cipher_list(cctx, tst == 0
+                                                  ? "AES128-GCM-SHA256"
+                                                  : "ECDHE-RSA-CHACHA20-POLY1305"))) {
+        goto end;
+    }
+
+    if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                      NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+
+    if (!TEST_true(SSL_write_ex(serverssl, msg, msglen, &written))
+            || !TEST_size_t_eq(written, msglen))
+        goto end;
+    while (total < msglen) {
+        if (!TEST_true(SSL_read_ex(clientssl, buf + total, msglen - total,
+                                   &readbytes)))
+            goto end;
+        total += readbytes;
+    }
+    if (!TEST_mem_eq(buf, total, msg, msglen))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    OPENSSL_free(msg);
+    OPENSSL_free(buf);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+/*
+ * Write a message in three pieces with SSL_writev(), so that records are
+ * written both straight from a piece and gathered across pieces, and read it
+ * back into three differently sized pieces with SSL_readv().
+ */
+static int test_ssl_iovec(void)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0;
+    size_t msglen = 3 * SSL3_RT_MAX_PLAIN_LENGTH + 100;
+    size_t wlens[3] = { 5, 3 * SSL3_RT_MAX_PLAIN_LENGTH, 95 };
+    size_t rlens[3] = { 7, SSL3_RT_MAX_PLAIN_LENGTH + 3, 0 };
+    unsigned char *msg = NULL, *buf = NULL;
+    SSL_IOVEC iov[3];
+    size_t written, readbytes, total = 0, off, i, n;
+
+    rlens[2] = msglen - rlens[0] - rlens[1];
+    if (!TEST_ptr(msg = OPENSSL_malloc(msglen))
+            || !TEST_ptr(buf = OPENSSL_zalloc(msglen)))
+        goto end;
+    for (i = 0; i < msglen; i++)
+        msg[i] = (unsigned char)(i % 251);
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION, 0,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+
+    for (i = 0, off = 0; i < 3; off += wlens[i++]) {
+        iov[i].iov_base = msg + off;
+        iov[i].iov_len = wlens[i];
+    }
+    if (!TEST_true(SSL_writev(serverssl, iov, 3, &written))
+            || !TEST_size_t_eq(written, msglen))
+        goto end;
+
+    while (total < msglen) {
+        /* Describe the part of each read piece that is still empty */
+        for (i = 0, off = 0; i < 3; off += rlens[i++]) {
+            n = total > off ? (total - off < rlens[i] ? total - off
+                                                      : rlens[i]) : 0;
+            iov[i].iov_base = buf + off + n;
+            iov[i].iov_len = rlens[i] - n;
+        }
+        if (!TEST_true(SSL_readv(clientssl, iov, 3, &readbytes)))
+            goto end;
+        total += readbytes;
+    }
+    if (!TEST_mem_eq(buf, total, msg, msglen))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    OPENSSL_free(msg);
+    OPENSSL_free(buf);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+/* Move what |bio| holds to the read BIO of |s| */
+static int move_bio_data(BIO *bio, SSL *s)
+{
+    char tmp[4096];
+    int n;
+
+    while ((n = BIO_read(bio, tmp, sizeof(tmp))) > 0)
+        if (!TEST_int_eq(BIO_write(SSL_get_rbio(s), tmp, n), n))
+            return 0;
+    return 1;
+}
+
+/*
+ * Test an SSL_writev() that has to be repeated because the transport takes
+ * no more than about one record at a time. A repeated call carries on where
+ * the first one stopped. In partial write mode (tst == 1) a call does not
+ * report success while a record it started is still waiting to be sent.
+ */
+static int test_ssl_writev_retry(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    BIO *wbio = NULL, *peer = NULL;
+    int testresult = 0, ret, retries = 0;
+    size_t msglen = 3 * SSL3_RT_MAX_PLAIN_LENGTH + 100;
+    size_t wlens[3] = { 5, 3 * SSL3_RT_MAX_PLAIN_LENGTH, 95 };
+    unsigned char *msg = NULL, *buf = NULL;
+    SSL_IOVEC iov[3];
+    size_t written, readbytes, total = 0, off, i;
+
+    if (!TEST_ptr(msg = OPENSSL_malloc(msglen))
+            || !TEST_ptr(buf = OPENSSL_zalloc(msglen)))
+        goto end;
+    for (i = 0; i < msglen; i++)
+        msg[i] = (unsigned char)(i % 251);
+    for (i = 0, off = 0; i < 3; off += wlens[i++]) {
+        iov[i].iov_base = msg + off;
+        iov[i].iov_len = wlens[i];
+    }
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION, 0,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(BIO_new_bio_pair(&wbio, SSL3_RT_MAX_PACKET_SIZE,
+                                           &peer, 0)))
+        goto end;
+    SSL_set0_wbio(serverssl, wbio);
+    wbio = NULL;
+    if (tst == 1)
+        SSL_set_mode(serverssl, SSL_MODE_ENABLE_PARTIAL_WRITE);
+
+    while (total < msglen) {
+        ret = SSL_writev(serverssl, iov, 3, &written);
+        if (ret == 1) {
+            if (tst == 0 && !TEST_size_t_eq(written, msglen - total))
+                goto end;
+            total += written;
+            /* Leave out what has been written */
+            for (i = 0; i < 3; i++) {
+                off = written < iov[i].iov_len ? written : iov[i].iov_len;
+                iov[i].iov_base = (unsigned char *)iov[i].iov_base + off;
+                iov[i].iov_len -= off;
+                written -= off;
+            }
+        } else if (!TEST_int_eq(SSL_get_error(serverssl, ret),
+                                SSL_ERROR_WANT_WRITE)) {
+            goto end;
+        } else {
+            retries++;
+        }
+        if (!move_bio_data(peer, clientssl))
+            goto end;
+    }
+    if (!TEST_int_gt(retries, 0))
+        goto end;
+
+    for (total = 0; total < msglen; total += readbytes)
+        if (!TEST_true(SSL_read_ex(clientssl, buf + total, msglen - total,
+                                   &readbytes)))
+            goto end;
+    if (!TEST_mem_eq(buf, total, msg, msglen))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    BIO_free(wbio);
+    BIO_free(peer);
+    OPENSSL_free(msg);
+    OPENSSL_free(buf);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+#ifndef OPENSSL_NO_TLS1_3
+/*
+ * Test SSL_MODE_DECRYPT_TO_USER_BUFFER. Records are read into a buffer that
+ * takes a whole record, with a KeyUpdate in between that has to be processed
+ * as usual, and then in pieces into a buffer that is too small. Last, a
+ * record with a bad tag must not leave its plaintext in the buffer.
+ */
+static int test_decrypt_to_user_buffer(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0;
+    unsigned char *msg = NULL, *buf = NULL;
+    size_t msglen = SSL3_RT_MAX_PLAIN_LENGTH;
+    size_t buflen = SSL3_RT_MAX_TLS13_ENCRYPTED_LENGTH;
+    size_t written, readbytes, i;
+    unsigned char rec[512];
+    int reclen;
+    const char *ciphersuites[] = {
+        "TLS_AES_128_GCM_SHA256",
+        "TLS_CHACHA20_POLY1305_SHA256",
+        "TLS_AES_128_CCM_SHA256"
+    };
+
+#ifdef OPENSSL_NO_CHACHA
+    if (tst == 1)
+        return 1;
+#endif
+
+    if (!TEST_ptr(msg = OPENSSL_malloc(msglen))
+            || !TEST_ptr(buf = OPENSSL_malloc(buflen)))
+        goto end;
+    for (i = 0; i < msglen; i++)
+        msg[i] = (unsigned char)(i % 251);
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), TLS1_3_VERSION,
+                                       TLS1_3_VERSION, &sctx, &cctx, cert,
+                                       privkey))
+            || !TEST_true(SSL_CTX_set_ciphersuites(sctx, ciphersuites[tst]))
+            || !TEST_true(SSL_CTX_set_ciphersuites(cctx, ciphersuites[tst]))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE)))
+        goto end;
+    SSL_set_mode(clientssl, SSL_MODE_DECRYPT_TO_USER_BUFFER);
+
+    if (!TEST_true(SSL_write_ex(serverssl, msg, 1000, &written))
+            || !TEST_true(SSL_key_update(serverssl,
+                                         SSL_KEY_UPDATE_NOT_REQUESTED))
+            || !TEST_true(SSL_write_ex(serverssl, msg, msglen, &written))
+            || !TEST_true(SSL_read_ex(clientssl, buf, buflen, &readbytes))
+            || !TEST_mem_eq(buf, readbytes, msg, 1000)
+            || !TEST_true(SSL_read_ex(clientssl, buf, buflen, &readbytes))
+            || !TEST_mem_eq(buf, readbytes, msg, msglen))
+        goto end;
+
+    /* A buffer that is too small is filled from the read buffer */
+    if (!TEST_true(SSL_write_ex(serverssl, msg, 300, &written))
+            || !TEST_true(SSL_read_ex(clientssl, buf, 100, &readbytes))
+            || !TEST_mem_eq(buf, readbytes, msg, 100)
+            || !TEST_true(SSL_read_ex(clientssl, buf, buflen, &readbytes))
+            || !TEST_mem_eq(buf, readbytes, msg + 100, 200))
+        goto end;
+
+    /* Plaintext that fails authentication is not left in the buffer */
+    memset(buf, 0, buflen);
+    if (!TEST_true(SSL_write_ex(serverssl, msg, 300, &written))
+            || !TEST_int_gt(reclen = BIO_read(SSL_get_rbio(clientssl), rec,
+                                              sizeof(rec)), 0))
+        goto end;
+    rec[reclen - 1] ^= 1;
+    if (!TEST_int_eq(BIO_write(SSL_get_rbio(clientssl), rec, reclen), reclen)
+            || !TEST_false(SSL_read_ex(clientssl, buf, buflen, &readbytes))
+            || !TEST_mem_ne(buf, 300, msg, 300))
+        goto end;
+    ERR_clear_error();
+
+    testresult = 1;
+
+ end:
+    OPENSSL_free(msg);
+    OPENSSL_free(buf);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+#endif
+
+/*
+ * Test the record buffer pool. With SSL_MODE_RELEASE_BUFFERS the buffers go
+ * back to the pool after each record, so a second connection should be able
+ * to take all of its buffers from there.
+ */
+static int test_buffer_pool(void)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0, i;
+    long misses = 0;
+    unsigned char buf[20];
+    size_t written, readbytes;
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(), TLS1_VERSION, 0,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_long_eq(SSL_CTX_get_buffer_pool_size(sctx), 0)
+            || !TEST_true(SSL_CTX_set_buffer_pool_size(sctx, 16))
+            || !TEST_long_eq(SSL_CTX_get_buffer_pool_size(sctx), 16))
+        goto end;
+    SSL_CTX_set_mode(sctx, SSL_MODE_RELEASE_BUFFERS);
+
+    for (i = 0; i < 2; i++) {
+        if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                          NULL, NULL))
+                || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                    SSL_ERROR_NONE))
+                || !TEST_true(SSL_write_ex(clientssl, "ping", 4, &written))
+                || !TEST_true(SSL_read_ex(serverssl, buf, sizeof(buf),
+                                          &readbytes))
+                || !TEST_true(SSL_write_ex(serverssl, "pong", 4, &written))
+                || !TEST_true(SSL_read_ex(clientssl, buf, sizeof(buf),
+                                          &readbytes)))
+            goto end;
+        /* Idle connections hold no buffers, they are all in the pool */
+        if (!TEST_long_gt(SSL_CTX_buffer_pool_bytes(sctx), 0))
+            goto end;
+        shutdown_ssl_connection(serverssl, clientssl);
+        serverssl = clientssl = NULL;
+        if (i == 0)
+            misses = SSL_CTX_buffer_pool_misses(sctx);
+    }
+    if (!TEST_long_gt(misses, 0)
+            || !TEST_long_eq(SSL_CTX_buffer_pool_misses(sctx), misses)
+            || !TEST_long_gt(SSL_CTX_buffer_pool_hits(sctx), 0))
+        goto end;
+
+    /*
+     * Once connections have been created the pool can still be resized, but
+     * neither turned off nor set up
+     */
+    if (!TEST_true(SSL_CTX_set_buffer_pool_size(sctx, 1))
+            || !TEST_long_eq(SSL_CTX_get_buffer_pool_size(sctx), 1)
+            || !TEST_false(SSL_CTX_set_buffer_pool_size(sctx, 0))
+            || !TEST_long_eq(SSL_CTX_get_buffer_pool_size(sctx), 1)
+            || !TEST_false(SSL_CTX_set_buffer_pool_size(cctx, 16))
+            || !TEST_long_eq(SSL_CTX_get_buffer_pool_size(cctx), 0))
+        goto end;
+    ERR_clear_error();
+
+    testresult = 1;
+
+ end:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+/*
+ * Test dynamic record sizing. The first 4000 bytes the server sends should go
+ * out in records of 1000 bytes, and the rest in full sized records.
+ */
+static int test_dynamic_record_size(void)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int testresult = 0;
+    unsigned char *msg = NULL, buf[1];
+    size_t msglen = 10000, written, readbytes, reclen, total = 0;
+
+    if (!TEST_ptr(msg = OPENSSL_zalloc(msglen))
+            || !TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                              TLS_client_method(),
+                                              TLS1_VERSION, 0,
+                                              &sctx, &cctx, cert, privkey))
+            || !TEST_false(SSL_CTX_set_dynamic_record_size(sctx,
+                               SSL3_RT_MAX_PLAIN_LENGTH + 1, 4000, 0))
+            || !TEST_true(SSL_CTX_set_dynamic_record_size(sctx, 1000, 4000,
+                                                          1))
+            || !TEST_true(create_ssl_objects(sctx, cctx, &serverssl,
+                                             &clientssl, NULL, NULL))
+            || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                SSL_ERROR_NONE))
+            || !TEST_true(SSL_write_ex(serverssl, msg, msglen, &written))
+            || !TEST_size_t_eq(written, msglen)
+            || !TEST_long_eq(SSL_get_dynamic_record_small(serverssl), 4)
+            || !TEST_long_eq(SSL_get_dynamic_record_resets(serverssl), 0))
+        goto end;
+
+    /* Reading a byte decrypts one record, the rest of which is pending */
+    while (total < msglen) {
+        reclen = total < 4000 ? 1000 : msglen - 4000;
+        if (!TEST_true(SSL_read_ex(clientssl, buf, sizeof(buf), &readbytes))
+                || !TEST_size_t_eq((size_t)SSL_pending(clientssl), reclen - 1)
+                || !TEST_true(SSL_read_ex(clientssl, msg, reclen - 1,
+                                          &readbytes)))
+            goto end;
+        total += reclen;
+    }
+
+    testresult = 1;
+
+ end:
+    OPENSSL_free(msg);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
+/*
+ * Check that the chain sent by the server follows changes to the explicit
+ * chain and to the chain store, while the encoded Certificate message is
+ * cached across handshakes.
+ * Test 0: TLSv1.2
+ * Test 1: TLSv1.3
+ */
+static int cert_msg_chain_len(SSL_CTX *sctx, SSL_CTX *cctx, int prot)
+{
+    SSL *serverssl = NULL, *clientssl = NULL;
+    int ret = -1;
+
+    if (TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                     NULL, NULL))
+            && TEST_true(SSL_set_max_proto_version(clientssl, prot))
+            && TEST_true(create_ssl_connection(serverssl, clientssl,
+                                               SSL_ERROR_NONE)))
+        ret = sk_X509_num(SSL_get_peer_cert_chain(clientssl));
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    return ret;
+}
+
+static int test_cert_msg_cache(int idx)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    BIO *in = NULL;
+    X509 *root = NULL;
+    char *rootfile = NULL;
+    int prot = idx == 0 ? TLS1_2_VERSION : TLS1_3_VERSION;
+    int testresult = 0;
+
+#ifdef OPENSSL_NO_TLS1_2
+    if (idx == 0)
+        return 1;
+#endif
+#ifdef OPENSSL_NO_TLS1_3
+    if (idx == 1)
+        return 1;
+#endif
+
+    if (!TEST_ptr(rootfile = test_mk_file_path(certsdir, "rootcert.pem"))
+            || !TEST_ptr(in = BIO_new_file(rootfile, "r"))
+            || !TEST_ptr(root = PEM_read_bio_X509(in, NULL, NULL, NULL))
+            || !TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                              TLS_client_method(),
+                                              TLS1_VERSION, TLS_MAX_VERSION,
+                                              &sctx, &cctx, cert, privkey)))
+        goto end;
+
+    /* No chain and an empty chain store: just the leaf, twice */
+    if (!TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 1)
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 1))
+        goto end;
+
+    /* An explicit chain replaces the cached message */
+    if (!TEST_true(SSL_CTX_add1_chain_cert(sctx, root))
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 2)
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 2))
+        goto end;
+
+    /* So does a change to the store the chain is built from */
+    if (!TEST_true(SSL_CTX_clear_chain_certs(sctx))
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 1)
+            || !TEST_true(X509_STORE_add_cert(SSL_CTX_get_cert_store(sctx),
+                                              root))
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 2)
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 2))
+        goto end;
+
+    /* Unless the chain is not built automatically */
+    SSL_CTX_set_mode(sctx, SSL_MODE_NO_AUTO_CHAIN);
+    if (!TEST_int_eq(cert_msg_chain_len(sctx, cctx, prot), 1))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    X509_free(root);
+    BIO_free(in);
+    OPENSSL_free(rootfile);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+
+#ifndef OPENSSL_NO_TLS1_3
+# define TEST_CERT_COMP_ALG 0x4242
+
+static int cert_comp_calls, cert_decomp_calls, cert_comp_declines;
+static unsigned char *cert_comp_stash = NULL;
+static size_t cert_comp_stash_len;
+
+/*
+ * A stand-in compressor that puts the message to one side and sends a single
+ * byte in its place, or declines to compress if |cert_comp_declines| is set.
+ */
+static int cert_compress_cb(SSL *s, const unsigned char *in, size_t inlen,
+                            unsigned char *out, size_t *outlen)
+{
+    cert_comp_calls++;
+    if (cert_comp_declines || *outlen < 1)
+        return 0;
+    OPENSSL_free(cert_comp_stash);
+    if ((cert_comp_stash = OPENSSL_memdup(in, inlen)) == NULL)
+        return 0;
+    cert_comp_stash_len = inlen;
+    out[0] = 'C';
+    *outlen = 1;
+    return 1;
+}
+
+static int cert_decompress_cb(SSL *s, const unsigned char *in, size_t inlen,
+                              unsigned char *out, size_t outlen)
+{
+    cert_decomp_calls++;
+    if (inlen != 1 || in[0] != 'C' || outlen != cert_comp_stash_len)
+        return 0;
+    memcpy(out, cert_comp_stash, outlen);
+    return 1;
+}
+
+/*
+ * Test certificate compression (RFC 8879)
+ * Test 0: The server compresses its Certificate message once and reuses it
+ * Test 1: The compressor declines, so the plain message is sent instead
+ * Test 2: The client does not offer compression
+ */
+static int test_cert_compression(int idx)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    int testresult = 0;
+
+    cert_comp_calls = cert_decomp_calls = 0;
+    cert_comp_declines = idx == 1;
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(),
+                                       TLS1_VERSION, TLS_MAX_VERSION,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_add_cert_compression_alg(sctx,
+                                                           TEST_CERT_COMP_ALG,
+                                                           cert_compress_cb,
+                                                           NULL)))
+        goto end;
+    if (idx != 2
+            && !TEST_true(SSL_CTX_add_cert_compression_alg(
+                              cctx, TEST_CERT_COMP_ALG, NULL,
+                              cert_decompress_cb)))
+        goto end;
+
+    /* Bad algorithms and duplicates are rejected */
+    if (idx == 0
+            && (!TEST_false(SSL_CTX_add_cert_compression_alg(
+                                cctx, 0, NULL, cert_decompress_cb))
+                || !TEST_false(SSL_CTX_add_cert_compression_alg(
+                                   cctx, TEST_CERT_COMP_ALG, NULL,
+                                   cert_decompress_cb))
+                || !TEST_false(SSL_CTX_add_cert_compression_alg(
+                                   cctx, TEST_CERT_COMP_ALG + 1, NULL, NULL))))
+        goto end;
+
+    if (!TEST_int_eq(cert_msg_chain_len(sctx, cctx, TLS1_3_VERSION), 1)
+            || !TEST_int_eq(cert_msg_chain_len(sctx, cctx, TLS1_3_VERSION), 1))
+        goto end;
+
+    /* Only the first handshake compresses anything */
+    if (!TEST_int_eq(cert_comp_calls, idx == 2 ? 0 : 1)
+            || !TEST_int_eq(cert_decomp_calls, idx == 0 ? 2 : 0))
+        goto end;
+
+#ifndef OPENSSL_NO_TLS1_2
+    /* TLSv1.2 has no CompressedCertificate message */
+    if (!TEST_int_eq(cert_msg_chain_len(sctx, cctx, TLS1_2_VERSION), 1)
+            || !TEST_int_eq(cert_decomp_calls, idx == 0 ? 2 : 0))
+        goto end;
+#endif
+
+    testresult = 1;
+
+ end:
+    OPENSSL_free(cert_comp_stash);
+    cert_comp_stash = NULL;
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+#endif
+
+#ifndef OPENSSL_NO_EC
+# define EPH_POOL_CONNS  5
+/*
+ * Test the pool of pre-generated ephemeral keys. Every connection must get a
+ * different key, including once the pool has been emptied and refilled.
+ * Test 0: TLSv1.3 with X25519 key shares
+ * Test 1: TLSv1.2 with P-256 ECDHE
+ */
+static int test_ephemeral_key_pool(int idx)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL *clientssl = NULL, *serverssl = NULL;
+    EVP_PKEY *keys[EPH_POOL_CONNS] = { NULL };
+    const char *group = idx == 0 ? "X25519" : "P-256";
+    int nid = idx == 0 ? NID_X25519 : NID_X9_62_prime256v1;
+    int testresult = 0, i, j;
+
+#ifdef OPENSSL_NO_TLS1_3
+    if (idx == 0)
+        return 1;
+#endif
+#ifdef OPENSSL_NO_TLS1_2
+    if (idx == 1)
+        return 1;
+#endif
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(),
+                                       TLS1_VERSION,
+                                       idx == 0 ? TLS_MAX_VERSION
+                                                : TLS1_2_VERSION,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set1_groups_list(sctx, group))
+            || !TEST_true(SSL_CTX_set1_groups_list(cctx, group))
+            || !TEST_true(SSL_CTX_set_cipher_list(cctx, "ECDHE")))
+        goto end;
+
+    /*
+     * Filling needs a pool, and the depth is capped. A deep pool is filled
+     * in several batches.
+     */
+    if (!TEST_false(SSL_CTX_fill_ephemeral_key_pool(sctx, nid))
+            || !TEST_false(SSL_CTX_set_ephemeral_key_pool(
+                               sctx, SSL_MAX_EPHEMERAL_KEY_POOL + 1))
+            || !TEST_true(SSL_CTX_set_ephemeral_key_pool(sctx, 40))
+            || !TEST_true(SSL_CTX_fill_ephemeral_key_pool(sctx, nid))
+            || !TEST_true(SSL_CTX_set_ephemeral_key_pool(sctx, 2))
+            || !TEST_size_t_eq(SSL_CTX_get_ephemeral_key_pool(sctx), 2)
+            || !TEST_false(SSL_CTX_fill_ephemeral_key_pool(sctx, NID_undef))
+            || !TEST_true(SSL_CTX_fill_ephemeral_key_pool(sctx, nid)))
+        goto end;
+    ERR_clear_error();
+
+    for (i = 0; i < EPH_POOL_CONNS; i++) {
+        if (!TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl,
+                                          NULL, NULL))
+                || !TEST_true(create_ssl_connection(serverssl, clientssl,
+                                                    SSL_ERROR_NONE))
+                || !TEST_true(SSL_get_peer_tmp_key(clientssl, &keys[i])))
+            goto end;
+        for (j = 0; j < i; j++) {
+            if (!TEST_int_ne(EVP_PKEY_cmp(keys[i], keys[j]), 1))
+                goto end;
+        }
+        SSL_shutdown(clientssl);
+        SSL_shutdown(serverssl);
+        SSL_free(serverssl);
+        SSL_free(clientssl);
+        serverssl = clientssl = NULL;
+    }
+
+    testresult = 1;
+
+ end:
+    for (i = 0; i < EPH_POOL_CONNS; i++)
+        EVP_PKEY_free(keys[i]);
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+    return testresult;
+}
+#endif
+
+static struct {
+    unsigned int maxprot;
+    const char *clntciphers;
+    const char *clnttls13ciphers;
+    const char *srvrciphers;
+    const char *srvrtls13ciphers;
+    const char *shared;
+} shared_ciphers_data[] = {
+/*
+ * We can't establish a connection (even in TLSv1.1) with these ciphersuites if
+ * TLSv1.3 is enabled but TLSv1.2 is disabled.
+ */
+#if defined(OPENSSL_NO_TLS1_3) || !defined(OPENSSL_NO_TLS1_2)
+    {
+        TLS1_2_VERSION,
+        "AES128-SHA:AES256-SHA",
+        NULL,
+        "AES256-SHA:DHE-RSA-AES128-SHA",
+        NULL,
+        "AES256-SHA"
+    },
+    {
+        TLS1_2_VERSION,
+        "AES128-SHA:DHE-RSA-AES128-SHA:AES256-SHA",
+        NULL,
+        "AES128-SHA:DHE-RSA-AES256-SHA:AES256-SHA",
+        NULL,
+        "AES128-SHA:AES256-SHA"
+    },
+    {
+        TLS1_2_VERSION,
+        "AES128-SHA:AES256-SHA",
+        NULL,
         "AES128-SHA:DHE-RSA-AES128-SHA",
         NULL,
         "AES128-SHA"
@@ -5631,6 +6952,108 @@ static int test_ticket_callbacks(int tst)
     return testresult;
 }
 
+/*
+ * Resume |sess| with a new connection. Returns 1 if it was resumed, 0 if it
+ * was not and -1 on error. The session of the new connection goes in |*out|.
+ */
+static int ticket_key_resume(SSL_CTX *sctx, SSL_CTX *cctx, SSL_SESSION *sess,
+                             SSL_SESSION **out)
+{
+    SSL *clientssl = NULL, *serverssl = NULL;
+    int ret = -1;
+
+    if (TEST_true(create_ssl_objects(sctx, cctx, &serverssl, &clientssl, NULL,
+                                     NULL))
+            && TEST_true(SSL_set_session(clientssl, sess))
+            && TEST_true(create_ssl_connection(serverssl, clientssl,
+                                               SSL_ERROR_NONE))
+            && TEST_ptr(*out = SSL_get1_session(clientssl))) {
+        ret = SSL_session_reused(clientssl);
+        SSL_shutdown(clientssl);
+        SSL_shutdown(serverssl);
+    }
+
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    return ret;
+}
+
+/*
+ * Test that tickets protected with previous ticket keys are accepted for as
+ * long as the keys are kept in the history.
+ * Test 0: TLSv1.2
+ * Test 1: TLSv1.3
+ */
+static int test_ticket_key_rotation(int tst)
+{
+    SSL_CTX *cctx = NULL, *sctx = NULL;
+    SSL_SESSION *sess1 = NULL, *sess2 = NULL, *tmp = NULL;
+    int testresult = 0;
+
+#ifdef OPENSSL_NO_TLS1_2
+    if (tst == 0)
+        return 1;
+#endif
+#ifdef OPENSSL_NO_TLS1_3
+    if (tst == 1)
+        return 1;
+#endif
+
+    if (!TEST_true(create_ssl_ctx_pair(TLS_server_method(),
+                                       TLS_client_method(),
+                                       TLS1_VERSION,
+                                       tst == 0 ? TLS1_2_VERSION
+                                                : TLS1_3_VERSION,
+                                       &sctx, &cctx, cert, privkey))
+            || !TEST_true(SSL_CTX_set_session_cache_mode(sctx,
+                                                         SSL_SESS_CACHE_OFF))
+            || !TEST_false(SSL_CTX_set_tlsext_ticket_key_history(sctx, 9))
+            || !TEST_true(SSL_CTX_set_tlsext_ticket_key_history(sctx, 1))
+            || !TEST_long_eq(SSL_CTX_get_tlsext_ticket_key_history(sctx), 1))
+        goto end;
+
+    /* Get a ticket protected with the first key */
+    if (!TEST_int_eq(ticket_key_resume(sctx, cctx, NULL, &sess1), 0))
+        goto end;
+
+    /* The first key is still accepted after one rotation */
+    if (!TEST_true(SSL_CTX_rotate_tlsext_ticket_keys(sctx))
+            || !TEST_int_eq(ticket_key_resume(sctx, cctx, sess1, &sess2), 1))
+        goto end;
+
+    /* A ticket for the second key survives one more rotation */
+    SSL_SESSION_free(sess2);
+    sess2 = NULL;
+    if (!TEST_int_eq(ticket_key_resume(sctx, cctx, NULL, &sess2), 0)
+            || !TEST_true(SSL_CTX_rotate_tlsext_ticket_keys(sctx))
+            || !TEST_int_eq(ticket_key_resume(sctx, cctx, sess2, &tmp), 1))
+        goto end;
+    SSL_SESSION_free(tmp);
+    tmp = NULL;
+
+    /* ...but the first key has been dropped */
+    if (!TEST_int_eq(ticket_key_resume(sctx, cctx, sess1, &tmp), 0))
+        goto end;
+    SSL_SESSION_free(tmp);
+    tmp = NULL;
+
+    /* Without a history only the current key is accepted */
+    if (!TEST_true(SSL_CTX_set_tlsext_ticket_key_history(sctx, 0))
+            || !TEST_int_eq(ticket_key_resume(sctx, cctx, sess2, &tmp), 0))
+        goto end;
+
+    testresult = 1;
+
+ end:
+    SSL_SESSION_free(sess1);
+    SSL_SESSION_free(sess2);
+    SSL_SESSION_free(tmp);
+    SSL_CTX_free(sctx);
+    SSL_CTX_free(cctx);
+
+    return testresult;
+}
+
 /*
  * Test bi-directional shutdown.
  * Test 0: TLSv1.2
@@ -6243,12 +7666,25 @@ int setup_tests(void)
 #ifndef OPENSSL_NO_DTLS
     ADD_TEST(test_large_message_dtls);
 #endif
+#if !defined(OPENSSL_NO_KTLS) && !defined(OPENSSL_NO_SOCK)
+    ADD_ALL_TESTS(test_ktls, 8);
+    ADD_ALL_TESTS(test_ktls_sendfile, 2);
+#endif
 #ifndef OPENSSL_NO_OCSP
     ADD_TEST(test_tlsext_status_type);
 #endif
     ADD_TEST(test_session_with_only_int_cache);
     ADD_TEST(test_session_with_only_ext_cache);
     ADD_TEST(test_session_with_both_cache);
+    ADD_TEST(test_session_with_sharded_cache);
+#if !defined(OPENSSL_NO_TLS1_3) || !defined(OPENSSL_NO_TLS1_2)
+    ADD_TEST(test_session_cache_sharded_limit);
+    ADD_ALL_TESTS(test_session_cache_expiry, 2);
+#endif
+#if defined(OPENSSL_SYS_UNIX) && defined(OPENSSL_THREADS) \
+    && (!defined(OPENSSL_NO_TLS1_3) || !defined(OPENSSL_NO_TLS1_2))
+    ADD_ALL_TESTS(test_shared_session_cache, 2);
+#endif
 #ifndef OPENSSL_NO_TLS1_3
     ADD_ALL_TESTS(test_stateful_tickets, 3);
     ADD_ALL_TESTS(test_stateless_tickets, 3);
@@ -6316,8 +7752,27 @@ int setup_tests(void)
 #endif
     ADD_ALL_TESTS(test_info_callback, 6);
     ADD_ALL_TESTS(test_ssl_pending, 2);
+#ifndef OPENSSL_NO_TLS1_2
+    ADD_ALL_TESTS(test_pipelining, 2);
+#endif
+    ADD_ALL_TESTS(test_large_write, 4);
+    ADD_TEST(test_ssl_iovec);
+    ADD_ALL_TESTS(test_ssl_writev_retry, 2);
+#ifndef OPENSSL_NO_TLS1_3
+    ADD_ALL_TESTS(test_decrypt_to_user_buffer, 3);
+#endif
+    ADD_TEST(test_buffer_pool);
+    ADD_TEST(test_dynamic_record_size);
+    ADD_ALL_TESTS(test_cert_msg_cache, 2);
+#ifndef OPENSSL_NO_TLS1_3
+    ADD_ALL_TESTS(test_cert_compression, 3);
+#endif
+#ifndef OPENSSL_NO_EC
+    ADD_ALL_TESTS(test_ephemeral_key_pool, 2);
+#endif
     ADD_ALL_TESTS(test_ssl_get_shared_ciphers, OSSL_NELEM(shared_ciphers_data));
     ADD_ALL_TESTS(test_ticket_callbacks, 12);
+    ADD_ALL_TESTS(test_ticket_key_rotation, 2);
     ADD_ALL_TESTS(test_shutdown, 7);
     ADD_ALL_TESTS(test_cert_cb, 6);
     ADD_ALL_TESTS(test_client_cert_cb, 2);
@@ -13,6 +13,7 @@
 #include "ssltestlib.h"
 #include "testutil.h"
 #include "e_os.h"
+#include "internal/sockets.h"
 
 #ifdef OPENSSL_SYS_UNIX
 # include <unistd.h>
@@ -297,6 +298,7 @@ typedef struct mempacket_test_ctx_st {
     unsigned int dropepoch;
     int droprec;
     int duprec;
+    int reorder;
 } MEMPACKET_TEST_CTX;
 
 static int mempacket_test_new(BIO *bi);
@@ -375,6 +377,22 @@ static int mempacket_test_read(BIO *bio, char *out, int outl)
     unsigned int seq, offset, len, epoch;
 
     BIO_clear_retry_flags(bio);
+    if (ctx->reorder) {
+        /*
+         * Hand out the packets written last first, so that every flight
+         * arrives in reverse order
+         */
+        if ((thispkt = sk_MEMPACKET_pop(ctx->pkts)) == NULL) {
+            BIO_set_retry_read(bio);
+            return -1;
+        }
+        if (outl > thispkt->len)
+            outl = thispkt->len;
+        memcpy(out, thispkt->data, outl);
+        mempacket_free(thispkt);
+        return outl;
+    }
+
     thispkt = sk_MEMPACKET_value(ctx->pkts, 0);
     if (thispkt == NULL || thispkt->num != ctx->currpkt) {
         /* Probably run out of data */
@@ -592,6 +610,9 @@ static long mempacket_test_ctrl(BIO *bio, int cmd, long num, void *ptr)
     case MEMPACKET_CTRL_SET_DUPLICATE_REC:
         ctx->duprec = (int)num;
         break;
+    case MEMPACKET_CTRL_SET_REORDER:
+        ctx->reorder = (int)num;
+        break;
     case BIO_CTRL_RESET:
     case BIO_CTRL_DUP:
     case BIO_CTRL_PUSH:
@@ -822,6 +843,156 @@ int create_ssl_objects(SSL_CTX *serverctx, SSL_CTX *clientctx, SSL **sssl,
     return 0;
 }
 
+#if !defined(OPENSSL_NO_KTLS) && !defined(OPENSSL_NO_SOCK)
+/*
+ * Create a pair of connected non-blocking TCP sockets over the IPv4 loopback
+ * interface. Used by tests that need a real kernel socket, such as Kernel TLS.
+ */
+int create_test_sockets(int *cfdp, int *sfdp)
+{
+    struct sockaddr_in sin;
+    socklen_t slen = sizeof(sin);
+    int afd = -1, cfd = -1, sfd = -1;
+    int cfd_connected = 0, ret = 0, tries = 0;
+
+    memset(&sin, 0, sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    afd = socket(AF_INET, SOCK_STREAM, 0);
+    if (afd < 0)
+        return 0;
+
+    if (bind(afd, (struct sockaddr *)&sin, sizeof(sin)) < 0
+            || getsockname(afd, (struct sockaddr *)&sin, &slen) < 0
+            || listen(afd, 1) < 0
+            || !BIO_socket_nbio(afd, 1))
+        goto out;
+
+    cfd = socket(AF_INET, SOCK_STREAM, 0);
+    if (cfd < 0)
+        goto out;
+
+    while (sfd < 0 || !cfd_connected) {
+        if (!cfd_connected) {
+            if (connect(cfd, (struct sockaddr *)&sin, sizeof(sin)) < 0)
+                goto out;
+            cfd_connected = 1;
+        }
+        sfd = accept(afd, NULL, NULL);
+        if (sfd < 0) {
+            if (get_last_socket_error() != EAGAIN || ++tries > 100)
+                goto out;
+            ossl_sleep(10);
+        }
+    }
+
+    if (!BIO_socket_nbio(cfd, 1) || !BIO_socket_nbio(sfd, 1))
+        goto out;
+
+    *cfdp = cfd;
+    *sfdp = sfd;
+    cfd = sfd = -1;
+    ret = 1;
+
+ out:
+    if (cfd >= 0)
+        BIO_closesocket(cfd);
+    if (sfd >= 0)
+        BIO_closesocket(sfd);
+    BIO_closesocket(afd);
+    return ret;
+}
+
+/*
+ * As create_ssl_objects() but the SSL objects talk to each other over the
+ * sockets |sfd| and |cfd| rather than memory BIOs. The sockets are not closed
+ * when the SSL objects are freed.
+ */
+int create_ssl_objects2(SSL_CTX *serverctx, SSL_CTX *clientctx, SSL **sssl,
+                        SSL **cssl, int sfd, int cfd)
+{
+    SSL *serverssl = NULL, *clientssl = NULL;
+    BIO *s_to_c_bio = NULL, *c_to_s_bio = NULL;
+
+    if (*sssl != NULL)
+        serverssl = *sssl;
+    else if (!TEST_ptr(serverssl = SSL_new(serverctx)))
+        goto error;
+    if (*cssl != NULL)
+        clientssl = *cssl;
+    else if (!TEST_ptr(clientssl = SSL_new(clientctx)))
+        goto error;
+
+    if (!TEST_ptr(s_to_c_bio = BIO_new_socket(sfd, BIO_NOCLOSE))
+            || !TEST_ptr(c_to_s_bio = BIO_new_socket(cfd, BIO_NOCLOSE)))
+        goto error;
+
+    SSL_set_bio(clientssl, c_to_s_bio, c_to_s_bio);
+    SSL_set_bio(serverssl, s_to_c_bio, s_to_c_bio);
+    *sssl = serverssl;
+    *cssl = clientssl;
+    return 1;
+
+ error:
+    SSL_free(serverssl);
+    SSL_free(clientssl);
+    BIO_free(s_to_c_bio);
+    BIO_free(c_to_s_bio);
+    return 0;
+}
+#endif
+
+#if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
+/*
+ * Create a pair of non-blocking UDP sockets on the loopback interface, each
+ * connected to the other.
+ */
+int create_test_dgram_sockets(int *cfdp, int *sfdp)
+{
+    struct sockaddr_in csin, ssin;
+    socklen_t slen;
+    int cfd = -1, sfd = -1, ret = 0;
+
+    memset(&csin, 0, sizeof(csin));
+    csin.sin_family = AF_INET;
+    csin.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    ssin = csin;
+
+    cfd = socket(AF_INET, SOCK_DGRAM, 0);
+    sfd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (cfd < 0 || sfd < 0)
+        goto out;
+
+    slen = sizeof(csin);
+    if (bind(cfd, (struct sockaddr *)&csin, sizeof(csin)) < 0
+            || getsockname(cfd, (struct sockaddr *)&csin, &slen) < 0)
+        goto out;
+    slen = sizeof(ssin);
+    if (bind(sfd, (struct sockaddr *)&ssin, sizeof(ssin)) < 0
+            || getsockname(sfd, (struct sockaddr *)&ssin, &slen) < 0)
+        goto out;
+
+    if (connect(cfd, (struct sockaddr *)&ssin, sizeof(ssin)) < 0
+            || connect(sfd, (struct sockaddr *)&csin, sizeof(csin)) < 0
+            || !BIO_socket_nbio(cfd, 1)
+            || !BIO_socket_nbio(sfd, 1))
+        goto out;
+
+    *cfdp = cfd;
+    *sfdp = sfd;
+    cfd = sfd = -1;
+    ret = 1;
+
+ out:
+    if (cfd >= 0)
+        BIO_closesocket(cfd);
+    if (sfd >= 0)
+        BIO_closesocket(sfd);
+    return ret;
+}
+#endif
+
 /*
  * Create an SSL connection, but does not ready any post-handshake
  * NewSessionTicket messages.
@@ -22,6 +22,14 @@ int create_bare_ssl_connection(SSL *serverssl, SSL *clientssl, int want,
                                int read);
 int create_ssl_connection(SSL *serverssl, SSL *clientssl, int want);
 void shutdown_ssl_connection(SSL *serverssl, SSL *clientssl);
+#if !defined(OPENSSL_NO_KTLS) && !defined(OPENSSL_NO_SOCK)
+int create_test_sockets(int *cfd, int *sfd);
+int create_ssl_objects2(SSL_CTX *serverctx, SSL_CTX *clientctx, SSL **sssl,
+                        SSL **cssl, int sfd, int cfd);
+#endif
+#if !defined(OPENSSL_NO_DGRAM) && !defined(OPENSSL_NO_SOCK)
+int create_test_dgram_sockets(int *cfd, int *sfd);
+#endif
 
 /* Note: Not thread safe! */
 const BIO_METHOD *bio_f_tls_dump_filter(void);
@@ -45,6 +53,7 @@ void bio_s_always_retry_free(void);
 #define MEMPACKET_CTRL_SET_DROP_REC         (2 << 15)
 #define MEMPACKET_CTRL_GET_DROP_REC         (3 << 15)
 #define MEMPACKET_CTRL_SET_DUPLICATE_REC    (4 << 15)
+#define MEMPACKET_CTRL_SET_REORDER          (5 << 15)
 
 int mempacket_test_inject(BIO *bio, const char *in, int inl, int pktnum,
                           int type);
@@ -165,6 +165,62 @@ end:
     return testresult;
 }
 
+static int test_frozen_stack(void)
+{
+    static int v[] = { 7, -3, 12, 0, 5 };
+    const int n = OSSL_NELEM(v);
+    STACK_OF(sint) *s = sk_sint_new(&int_compare);
+    STACK_OF(sint) *dup = NULL;
+    int i, zero = 0, twelve = 12;
+    int testresult = 0;
+
+    if (!TEST_ptr(s))
+        goto end;
+    for (i = 0; i < n; i++)
+        if (!TEST_int_eq(sk_sint_push(s, v + i), i + 1))
+            goto end;
+
+    if (!TEST_false(sk_sint_is_frozen(s))
+            || !TEST_true(sk_sint_freeze(s))
+            || !TEST_true(sk_sint_is_frozen(s))
+            || !TEST_true(sk_sint_is_sorted(s)))
+        goto end;
+
+    /* Finds work as on any sorted stack */
+    if (!TEST_int_eq(sk_sint_find(s, &zero), 1)
+            || !TEST_int_eq(sk_sint_find(s, &twelve), 4))
+        goto end;
+
+    /* Nothing can change the elements, their order or the comparison */
+    if (!TEST_int_eq(sk_sint_push(s, &zero), 0)
+            || !TEST_int_eq(sk_sint_insert(s, &zero, 0), 0)
+            || !TEST_ptr_null(sk_sint_set(s, 0, &zero))
+            || !TEST_ptr_null(sk_sint_delete(s, 0))
+            || !TEST_ptr_null(sk_sint_delete_ptr(s, v))
+            || !TEST_ptr_null(sk_sint_pop(s))
+            || !TEST_ptr_null(sk_sint_shift(s))
+            || !TEST_false(sk_sint_reserve(s, 10))
+            || !TEST_true(sk_sint_set_cmp_func(s, NULL) == &int_compare))
+        goto end;
+    sk_sint_zero(s);
+    if (!TEST_int_eq(sk_sint_num(s), n)
+            || !TEST_int_eq(*sk_sint_value(s, 0), -3)
+            || !TEST_int_eq(sk_sint_find(s, &twelve), 4))
+        goto end;
+
+    /* A copy can be changed again */
+    if (!TEST_ptr(dup = sk_sint_dup(s))
+            || !TEST_false(sk_sint_is_frozen(dup))
+            || !TEST_int_eq(sk_sint_push(dup, &zero), n + 1))
+        goto end;
+
+    testresult = 1;
+end:
+    sk_sint_free(dup);
+    sk_sint_free(s);
+    return testresult;
+}
+
 static int uchar_compare(const unsigned char *const *a,
                          const unsigned char *const *b)
 {
@@ -373,6 +429,7 @@ end:
 int setup_tests(void)
 {
     ADD_ALL_TESTS(test_int_stack, 4);
+    ADD_TEST(test_frozen_stack);
     ADD_ALL_TESTS(test_uchar_stack, 4);
     ADD_TEST(test_SS_stack);
     ADD_TEST(test_SU_stack);
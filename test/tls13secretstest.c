@@ -216,6 +216,15 @@ int ossl_statem_export_early_allowed(SSL *s)
     return 1;
 }
 
+#ifndef OPENSSL_NO_KTLS
+int ssl_ktls_start(SSL *s, int is_tx, const EVP_CIPHER *c,
+                   const unsigned char *key, size_t keylen,
+                   const unsigned char *iv, size_t ivlen)
+{
+    return 0;
+}
+#endif
+
 /* End of mocked out code */
 
 static int test_secret(SSL *s, unsigned char *prk,
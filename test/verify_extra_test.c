@@ -8,6 +8,7 @@
  */
 
 #include <stdio.h>
+#include <errno.h>
 #include <openssl/crypto.h>
 #include <openssl/bio.h>
 #include <openssl/x509.h>
@@ -15,6 +16,11 @@
 #include <openssl/err.h>
 #include "testutil.h"
 
+#if defined(OPENSSL_SYS_UNIX)
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
 static const char *roots_f;
 static const char *untrusted_f;
 static const char *bad_f;
@@ -175,6 +181,299 @@ static int test_store_ctx(void)
     return testresult;
 }
 
+static int store_count_certs(X509_STORE_CTX *sctx, X509_NAME *nm)
+{
+    STACK_OF(X509) *certs = X509_STORE_CTX_get1_certs(sctx, nm);
+    int num = sk_X509_num(certs);
+
+    sk_X509_pop_free(certs, X509_free);
+    return num;
+}
+
+/*
+ * Check that lookups in a store see the objects added to it after earlier
+ * lookups, including further ones with a subject name already present.
+ */
+static int test_store_lookup(void)
+{
+    X509_STORE *store = NULL;
+    X509_STORE_CTX *sctx = NULL;
+    STACK_OF(X509) *roots = NULL, *untrusted = NULL;
+    X509_OBJECT *obj = NULL;
+    X509 *leaf;
+    X509_NAME *nm;
+    int i, testresult = 0;
+
+    if (!TEST_ptr(store = X509_STORE_new())
+            || !TEST_ptr(sctx = X509_STORE_CTX_new())
+            || !TEST_ptr(roots = load_certs_from_file(roots_f))
+            || !TEST_ptr(untrusted = load_certs_from_file(untrusted_f))
+            || !TEST_int_eq(sk_X509_num(untrusted), 2)
+            || !TEST_true(X509_STORE_CTX_init(sctx, store, NULL, NULL)))
+        goto err;
+
+    /* untrusted.pem holds subinterCA and then the leaf */
+    leaf = sk_X509_value(untrusted, 1);
+    nm = X509_get_subject_name(sk_X509_value(untrusted, 0));
+
+    for (i = 0; i < sk_X509_num(roots); i++)
+        if (!TEST_true(X509_STORE_add_cert(store, sk_X509_value(roots, i))))
+            goto err;
+
+    /* Only subinterCA (ss) has this subject name so far */
+    if (!TEST_int_eq(store_count_certs(sctx, nm), 1)
+            || !TEST_ptr_null(obj = X509_STORE_CTX_get_obj_by_subject(sctx,
+                                        X509_LU_X509,
+                                        X509_get_subject_name(leaf))))
+        goto err;
+
+    for (i = 0; i < sk_X509_num(untrusted); i++)
+        if (!TEST_true(X509_STORE_add_cert(store, sk_X509_value(untrusted, i))))
+            goto err;
+    /* Adding the same certificate again is not an error */
+    if (!TEST_true(X509_STORE_add_cert(store, leaf)))
+        goto err;
+
+    if (!TEST_int_eq(store_count_certs(sctx, nm), 2)
+            || !TEST_ptr(obj = X509_STORE_CTX_get_obj_by_subject(sctx,
+                                   X509_LU_X509, X509_get_subject_name(leaf)))
+            || !TEST_int_eq(X509_cmp(X509_OBJECT_get0_X509(obj), leaf), 0)
+            || !TEST_int_eq(store_count_certs(sctx,
+                                              X509_get_subject_name(leaf)), 1))
+        goto err;
+
+    testresult = 1;
+
+ err:
+    X509_OBJECT_free(obj);
+    X509_STORE_CTX_free(sctx);
+    X509_STORE_free(store);
+    sk_X509_pop_free(roots, X509_free);
+    sk_X509_pop_free(untrusted, X509_free);
+    return testresult;
+}
+
+/*
+ * Verify |leaf| with |untrusted| against |store| and return the issuer
+ * certificate object that ended up in the chain, or NULL on failure.
+ */
+static X509 *verify_get0_issuer(X509_STORE *store, X509 *leaf,
+                                STACK_OF(X509) *untrusted)
+{
+    X509_STORE_CTX *sctx = X509_STORE_CTX_new();
+    X509 *issuer = NULL;
+
+    if (TEST_ptr(sctx)
+            && TEST_true(X509_STORE_CTX_init(sctx, store, leaf, untrusted))
+            && TEST_int_eq(X509_verify_cert(sctx), 1)
+            && TEST_int_eq(X509_STORE_CTX_get_error(sctx), X509_V_OK)
+            && TEST_int_eq(sk_X509_num(X509_STORE_CTX_get0_chain(sctx)), 3)
+            && TEST_ptr_eq(sk_X509_value(X509_STORE_CTX_get0_chain(sctx), 0),
+                           leaf))
+        issuer = sk_X509_value(X509_STORE_CTX_get0_chain(sctx), 1);
+    X509_STORE_CTX_free(sctx);
+    return issuer;
+}
+
+static int test_verify_cache(void)
+{
+    X509_STORE *store = NULL;
+    STACK_OF(X509) *roots = NULL, *first = NULL, *second = NULL;
+    STACK_OF(X509) *bad = NULL;
+    X509_STORE_CTX *sctx = NULL;
+    X509_OBJECT *obj = NULL;
+    X509 *leaf;
+    unsigned long generation;
+    int testresult = 0;
+
+    if (!TEST_ptr(store = X509_STORE_new())
+            || !TEST_ptr(roots = load_certs_from_file(roots_f))
+            || !TEST_ptr(first = load_certs_from_file(untrusted_f))
+            || !TEST_ptr(second = load_certs_from_file(untrusted_f))
+            || !TEST_ptr(bad = load_certs_from_file(bad_f))
+            || !TEST_int_eq(sk_X509_num(second), 2)
+            || !TEST_true(X509_STORE_set_verify_cache_size(store, 4))
+            || !TEST_true(X509_STORE_set_flags(store,
+                                               X509_V_FLAG_PARTIAL_CHAIN))
+            /* interCA is the only trust anchor */
+            || !TEST_true(X509_STORE_add_cert(store, sk_X509_value(roots, 0))))
+        goto err;
+
+    /*
+     * The untrusted subinterCA goes into the chain. Once cached, the chain
+     * verified first is handed out again for an identical request, even
+     * though the caller supplied different, if equal, objects.
+     */
+    leaf = sk_X509_value(second, 1);
+    if (!TEST_ptr_eq(verify_get0_issuer(store, sk_X509_value(first, 1), first),
+                     sk_X509_value(first, 0))
+            || !TEST_ptr_eq(verify_get0_issuer(store, leaf, second),
+                            sk_X509_value(first, 0)))
+        goto err;
+
+    /* Merely locking the store, without changing it, keeps the cache */
+    generation = X509_STORE_get_generation(store);
+    if (!TEST_true(X509_STORE_lock(store))
+            || !TEST_true(X509_STORE_unlock(store))
+            || !TEST_ulong_eq(X509_STORE_get_generation(store), generation)
+            || !TEST_ptr_eq(verify_get0_issuer(store, leaf, second),
+                            sk_X509_value(first, 0)))
+        goto err;
+
+    /* Changing the store, even in an unrelated way, invalidates the cache */
+    if (!TEST_true(X509_STORE_add_cert(store, sk_X509_value(bad, 0)))
+            || !TEST_ptr_eq(verify_get0_issuer(store, leaf, second),
+                            sk_X509_value(second, 0)))
+        goto err;
+
+    /* As does changing the objects directly while holding the lock */
+    if (!TEST_true(X509_STORE_lock(store)))
+        goto err;
+    obj = sk_X509_OBJECT_pop(X509_STORE_get0_objects(store));
+    if (!TEST_true(X509_STORE_unlock(store))
+            || !TEST_ptr(obj)
+            || !TEST_ulong_ne(X509_STORE_get_generation(store), generation)
+            || !TEST_true(X509_STORE_add_cert(store,
+                                              X509_OBJECT_get0_X509(obj))))
+        goto err;
+    generation = X509_STORE_get_generation(store);
+    if (!TEST_ptr_eq(verify_get0_issuer(store, leaf, second),
+                     sk_X509_value(second, 0))
+            || !TEST_true(X509_STORE_lock(store))
+            || !TEST_true(X509_STORE_unlock(store))
+            || !TEST_ulong_eq(X509_STORE_get_generation(store), generation))
+        goto err;
+
+    /* As does rejecting the trust anchor of a cached chain */
+    if (!TEST_ptr_eq(verify_get0_issuer(store, leaf, second),
+                     sk_X509_value(second, 0))
+            || !TEST_true(X509_add1_reject_object(sk_X509_value(roots, 0),
+                              OBJ_nid2obj(NID_anyExtendedKeyUsage)))
+            || !TEST_ptr(sctx = X509_STORE_CTX_new())
+            || !TEST_true(X509_STORE_CTX_init(sctx, store, leaf, second))
+            || !TEST_int_le(X509_verify_cert(sctx), 0))
+        goto err;
+    X509_STORE_CTX_free(sctx);
+    sctx = NULL;
+    X509_reject_clear(sk_X509_value(roots, 0));
+
+    /* And so do different verification parameters */
+    X509_VERIFY_PARAM_set_depth(X509_STORE_get0_param(store), 5);
+    if (!TEST_ptr_eq(verify_get0_issuer(store, sk_X509_value(first, 1), first),
+                     sk_X509_value(first, 0)))
+        goto err;
+
+    /* Disabling the cache makes every verification start from scratch */
+    if (!TEST_true(X509_STORE_set_verify_cache_size(store, 0))
+            || !TEST_ptr_eq(verify_get0_issuer(store, leaf, second),
+                            sk_X509_value(second, 0)))
+        goto err;
+
+    testresult = 1;
+
+ err:
+    X509_STORE_CTX_free(sctx);
+    X509_OBJECT_free(obj);
+    X509_STORE_free(store);
+    sk_X509_pop_free(roots, X509_free);
+    sk_X509_pop_free(first, X509_free);
+    sk_X509_pop_free(second, X509_free);
+    sk_X509_pop_free(bad, X509_free);
+    return testresult;
+}
+
+#if defined(OPENSSL_SYS_UNIX)
+# define INDEX_DIR "by_dir_index"
+
+/* Write |x| into INDEX_DIR under its subject name hash */
+static int write_hashed_cert(X509 *x, char *path, size_t pathlen)
+{
+    BIO *bio;
+    int ret;
+
+    BIO_snprintf(path, pathlen, "%s/%08lx.0", INDEX_DIR,
+                 X509_NAME_hash(X509_get_subject_name(x)));
+    if ((bio = BIO_new_file(path, "w")) == NULL)
+        return 0;
+    ret = PEM_write_bio_X509(bio, x);
+    BIO_free(bio);
+    return ret;
+}
+
+/*
+ * Check that an indexed hashed directory finds the certificates that were
+ * there when it was indexed, and new ones once the index expires.
+ */
+static int test_by_dir_index(void)
+{
+    X509_STORE *store = NULL;
+    X509_STORE_CTX *sctx = NULL;
+    X509_LOOKUP *lookup;
+    X509_OBJECT *obj = NULL;
+    STACK_OF(X509) *roots = NULL;
+    X509 *x1, *x2;
+    char path1[64] = "", path2[64] = "";
+    int testresult = 0;
+
+    if (!TEST_ptr(roots = load_certs_from_file(roots_f))
+            || !TEST_int_eq(sk_X509_num(roots), 2))
+        goto err;
+    x1 = sk_X509_value(roots, 0);
+    x2 = sk_X509_value(roots, 1);
+
+    if (!TEST_true(mkdir(INDEX_DIR, 0700) == 0 || errno == EEXIST)
+            || !TEST_true(write_hashed_cert(x1, path1, sizeof(path1)))
+            || !TEST_ptr(store = X509_STORE_new())
+            || !TEST_ptr(lookup = X509_STORE_add_lookup(store,
+                                                        X509_LOOKUP_hash_dir()))
+            || !TEST_true(X509_LOOKUP_add_dir(lookup, INDEX_DIR,
+                                              X509_FILETYPE_PEM))
+            || !TEST_true(X509_LOOKUP_index_dirs(lookup, 3600))
+            || !TEST_ptr(sctx = X509_STORE_CTX_new())
+            || !TEST_true(X509_STORE_CTX_init(sctx, store, NULL, NULL)))
+        goto err;
+
+    if (!TEST_ptr(obj = X509_STORE_CTX_get_obj_by_subject(sctx, X509_LU_X509,
+                            X509_get_subject_name(x1)))
+            || !TEST_int_eq(X509_cmp(X509_OBJECT_get0_X509(obj), x1), 0))
+        goto err;
+    X509_OBJECT_free(obj);
+    obj = NULL;
+
+    /*
+     * A file added after indexing is not seen until the index expires, or
+     * is rebuilt because the ttl is set again. A ttl of 0 never expires.
+     */
+    if (!TEST_true(X509_LOOKUP_index_dirs(lookup, 0))
+            || !TEST_ptr_null(obj = X509_STORE_CTX_get_obj_by_subject(sctx,
+                                        X509_LU_X509,
+                                        X509_get_subject_name(x2)))
+            || !TEST_true(write_hashed_cert(x2, path2, sizeof(path2)))
+            || !TEST_ptr_null(obj = X509_STORE_CTX_get_obj_by_subject(sctx,
+                                        X509_LU_X509,
+                                        X509_get_subject_name(x2)))
+            || !TEST_true(X509_LOOKUP_index_dirs(lookup, 0))
+            || !TEST_ptr(obj = X509_STORE_CTX_get_obj_by_subject(sctx,
+                                   X509_LU_X509, X509_get_subject_name(x2)))
+            || !TEST_int_eq(X509_cmp(X509_OBJECT_get0_X509(obj), x2), 0))
+        goto err;
+
+    testresult = 1;
+
+ err:
+    X509_OBJECT_free(obj);
+    X509_STORE_CTX_free(sctx);
+    X509_STORE_free(store);
+    sk_X509_pop_free(roots, X509_free);
+    if (path1[0] != '\0')
+        unlink(path1);
+    if (path2[0] != '\0')
+        unlink(path2);
+    rmdir(INDEX_DIR);
+    return testresult;
+}
+#endif
+
 int setup_tests(void)
 {
     if (!TEST_ptr(roots_f = test_get_argument(0))
@@ -186,5 +485,10 @@ int setup_tests(void)
 
     ADD_TEST(test_alt_chains_cert_forgery);
     ADD_TEST(test_store_ctx);
+    ADD_TEST(test_store_lookup);
+    ADD_TEST(test_verify_cache);
+#if defined(OPENSSL_SYS_UNIX)
+    ADD_TEST(test_by_dir_index);
+#endif
     return 1;
 }